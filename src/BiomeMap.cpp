@@ -0,0 +1,164 @@
+// BiomeMap.cpp
+// Climate sampling, region cache and per-biome tables.
+
+#include "BiomeMap.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+// -----------------------------
+// Biome tables
+// -----------------------------
+static const glm::vec3 kWater(0.0f, 0.2f, 0.7f);
+static const glm::vec3 kSand(0.9f, 0.85f, 0.6f);
+static const glm::vec3 kGrass(0.2f, 0.7f, 0.2f);
+static const glm::vec3 kDarkGrass(0.1f, 0.5f, 0.15f);
+static const glm::vec3 kDirt(0.45f, 0.33f, 0.21f);
+static const glm::vec3 kStone(0.5f, 0.5f, 0.5f);
+static const glm::vec3 kRock(0.85f, 0.85f, 0.85f);
+static const glm::vec3 kSnow(1.0f, 1.0f, 1.0f);
+static const glm::vec3 kRedSand(0.85f, 0.6f, 0.35f);
+
+static const BiomeInfo kBiomes[static_cast<int>(Biome::Count)] = {
+    // name        base  amp  band  layers (bottom -> top)
+    { "ocean",      2.0f,  4.0f, 2, { kWater, kWater, kSand, kSand, kSand, kSand, kSand } },
+    { "beach",      4.0f,  4.0f, 2, { kWater, kSand, kSand, kSand, kSand, kGrass, kGrass } },
+    { "plains",     1.0f, 16.0f, 3, { kWater, kSand, kGrass, kDirt, kStone, kRock, kSnow } }, // original palette
+    { "forest",     5.0f, 16.0f, 3, { kWater, kDirt, kDarkGrass, kDarkGrass, kDirt, kStone, kRock } },
+    { "desert",     5.0f, 10.0f, 3, { kSand, kSand, kSand, kRedSand, kRedSand, kSand, kSand } },
+    { "tundra",     4.0f, 12.0f, 3, { kWater, kStone, kDirt, kRock, kSnow, kSnow, kSnow } },
+    { "mountains", 12.0f, 40.0f, 7, { kStone, kGrass, kDirt, kStone, kRock, kRock, kSnow } },
+};
+
+const BiomeInfo& GetBiomeInfo(Biome biome) {
+    return kBiomes[static_cast<int>(biome)];
+}
+
+glm::vec3 BiomeLayerColor(Biome biome, int y) {
+    const BiomeInfo& info = GetBiomeInfo(biome);
+    int band = std::min(6, std::max(0, y) / info.bandHeight);
+    return info.layers[band];
+}
+
+// -----------------------------
+// Construction
+// -----------------------------
+BiomeMap::BiomeMap(uint32_t seed_)
+    : seed(seed_),
+    temperatureNoise(seed_ + 1),
+    humidityNoise(seed_ + 2),
+    continentalNoise(seed_ + 3),
+    detailNoise(seed_) {}
+
+// -----------------------------
+// Classification
+// -----------------------------
+Biome BiomeMap::Classify(const ClimateSample& c) {
+    if (c.continentalness < 0.30f) return Biome::Ocean;
+    if (c.continentalness < 0.38f) return Biome::Beach;
+    if (c.continentalness > 0.72f) return Biome::Mountains;
+    if (c.temperature < 0.30f) return Biome::Tundra;
+    if (c.temperature > 0.62f && c.humidity < 0.45f) return Biome::Desert;
+    if (c.humidity > 0.58f) return Biome::Forest;
+    return Biome::Plains;
+}
+
+// -----------------------------
+// Lattice sampling and region cache
+// -----------------------------
+// Octave noise clusters around 0.5; stretch it so the thresholds above are reachable.
+static float stretch01(double n) {
+    return static_cast<float>(std::clamp((n - 0.5) * 2.5 + 0.5, 0.0, 1.0));
+}
+
+BiomeMap::LatticePoint BiomeMap::samplePoint(int wx, int wz) const {
+    LatticePoint p;
+    p.climate.temperature = stretch01(temperatureNoise.normalizedOctave2D_01(wx / 512.0, wz / 512.0, 3));
+    p.climate.humidity = stretch01(humidityNoise.normalizedOctave2D_01(wx / 384.0, wz / 384.0, 3));
+    p.climate.continentalness = stretch01(continentalNoise.normalizedOctave2D_01(wx / 768.0, wz / 768.0, 4));
+
+    const BiomeInfo& info = GetBiomeInfo(Classify(p.climate));
+    p.heightBase = info.heightBase;
+    p.heightAmplitude = info.heightAmplitude;
+    return p;
+}
+
+const BiomeMap::Region& BiomeMap::region(int rx, int rz) {
+    int64_t k = GridKey(rx, rz);
+    if (lastRegion && lastKey == k) return *lastRegion;
+
+    auto it = regions.find(k);
+    if (it == regions.end()) {
+        if (regions.size() >= kMaxRegions) {
+            regions.erase(regionOrder.front());
+            regionOrder.pop_front();
+        }
+
+        const int n = kRegionCells + 1;
+        Region r;
+        r.points.resize(static_cast<size_t>(n) * static_cast<size_t>(n));
+        const int baseX = rx * kRegionCells * kCellSize;
+        const int baseZ = rz * kRegionCells * kCellSize;
+        for (int z = 0; z < n; ++z)
+            for (int x = 0; x < n; ++x)
+                r.points[static_cast<size_t>(x) + static_cast<size_t>(z) * n] = samplePoint(baseX + x * kCellSize, baseZ + z * kCellSize);
+
+        it = regions.emplace(k, std::move(r)).first;
+        regionOrder.push_back(k);
+    }
+
+    lastKey = k;
+    lastRegion = &it->second;
+    return it->second;
+}
+
+BiomeMap::LatticePoint BiomeMap::interpolate(int wx, int wz) {
+    const int regionSpan = kRegionCells * kCellSize;
+    int rx = FloorDiv(wx, regionSpan), rz = FloorDiv(wz, regionSpan);
+    int lx = wx - rx * regionSpan;
+    int lz = wz - rz * regionSpan;
+
+    const Region& r = region(rx, rz);
+    const int n = kRegionCells + 1;
+    int cx = lx / kCellSize, cz = lz / kCellSize;
+    float fx = static_cast<float>(lx - cx * kCellSize) / kCellSize;
+    float fz = static_cast<float>(lz - cz * kCellSize) / kCellSize;
+
+    const LatticePoint& p00 = r.points[static_cast<size_t>(cx) + static_cast<size_t>(cz) * n];
+    const LatticePoint& p10 = r.points[static_cast<size_t>(cx + 1) + static_cast<size_t>(cz) * n];
+    const LatticePoint& p01 = r.points[static_cast<size_t>(cx) + static_cast<size_t>(cz + 1) * n];
+    const LatticePoint& p11 = r.points[static_cast<size_t>(cx + 1) + static_cast<size_t>(cz + 1) * n];
+
+    auto lerp2 = [&](float a, float b, float c, float d) {
+        float top = a + (b - a) * fx;
+        float bottom = c + (d - c) * fx;
+        return top + (bottom - top) * fz;
+    };
+
+    LatticePoint out;
+    out.climate.temperature = lerp2(p00.climate.temperature, p10.climate.temperature, p01.climate.temperature, p11.climate.temperature);
+    out.climate.humidity = lerp2(p00.climate.humidity, p10.climate.humidity, p01.climate.humidity, p11.climate.humidity);
+    out.climate.continentalness = lerp2(p00.climate.continentalness, p10.climate.continentalness, p01.climate.continentalness, p11.climate.continentalness);
+    out.heightBase = lerp2(p00.heightBase, p10.heightBase, p01.heightBase, p11.heightBase);
+    out.heightAmplitude = lerp2(p00.heightAmplitude, p10.heightAmplitude, p01.heightAmplitude, p11.heightAmplitude);
+    return out;
+}
+
+// -----------------------------
+// Public queries
+// -----------------------------
+ClimateSample BiomeMap::Climate(int wx, int wz) {
+    return interpolate(wx, wz).climate;
+}
+
+TerrainColumn BiomeMap::Column(int wx, int wz, int maxHeight) {
+    LatticePoint p = interpolate(wx, wz);
+
+    // same single detail lookup (and frequency) as the original generator
+    const double freq = 0.05;
+    double n = std::clamp(detailNoise.noise2D_01(wx * freq, wz * freq), 0.0, 1.0);
+
+    int h = static_cast<int>(p.heightBase + static_cast<float>(n) * p.heightAmplitude);
+    h = std::clamp(h, 1, maxHeight);
+    return TerrainColumn{ h, Classify(p.climate) };
+}
@@ -0,0 +1,107 @@
+// BiomeMap.hpp
+// Coarse climate layer that drives terrain shape and colouring.
+//
+// Temperature, humidity and continentalness are low-frequency noise fields that
+// only change over hundreds of blocks, so they are sampled on a lattice every
+// kCellSize blocks and cached per region. Each lattice point also stores the
+// height curve (base + amplitude) of the biome its climate selects. Columns
+// bilinearly interpolate those values, so the only per-column noise left is the
+// single detail lookup the flat generator already did.
+
+#pragma once
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "GridCoords.hpp"
+#include "PerlinNoise.hpp"
+
+enum class Biome : uint8_t {
+    Ocean,
+    Beach,
+    Plains,
+    Forest,
+    Desert,
+    Tundra,
+    Mountains,
+    Count
+};
+
+// Per-biome height curve and layer colours.
+struct BiomeInfo {
+    const char* name;
+    float heightBase;      // column height at detail noise 0
+    float heightAmplitude; // added at detail noise 1
+    int bandHeight;        // blocks per colour band (index = y / bandHeight)
+    glm::vec3 layers[7];   // colour bands from y = 0 upwards (last one repeats)
+};
+
+const BiomeInfo& GetBiomeInfo(Biome biome);
+
+// Colour of a block at height y in a column of the given biome.
+glm::vec3 BiomeLayerColor(Biome biome, int y);
+
+struct ClimateSample {
+    float temperature = 0.0f;     // 0 cold .. 1 hot
+    float humidity = 0.0f;        // 0 dry .. 1 wet
+    float continentalness = 0.0f; // 0 deep ocean .. 1 inland/mountains
+};
+
+struct TerrainColumn {
+    int height;
+    Biome biome;
+};
+
+class BiomeMap {
+public:
+    static const int kCellSize = 8;        // blocks between climate samples
+    static const int kRegionCells = 8;     // lattice cells per region side (64 blocks)
+    static const size_t kMaxRegions = 256; // cached regions before the oldest is dropped
+
+    explicit BiomeMap(uint32_t seed = 123456);
+
+    // Biome classification from a climate sample.
+    static Biome Classify(const ClimateSample& c);
+
+    // Interpolated climate at world column (wx, wz).
+    ClimateSample Climate(int wx, int wz);
+
+    // Height (clamped to [1, maxHeight]) and biome of world column (wx, wz).
+    TerrainColumn Column(int wx, int wz, int maxHeight);
+
+    uint32_t GetSeed() const { return seed; }
+    size_t CachedRegions() const { return regions.size(); }
+
+private:
+    struct LatticePoint {
+        ClimateSample climate;
+        float heightBase;
+        float heightAmplitude;
+    };
+    struct Region {
+        // (kRegionCells + 1)^2 points: includes the far edge so every cell of
+        // the region can be interpolated without touching a neighbour region.
+        std::vector<LatticePoint> points;
+    };
+
+    uint32_t seed;
+    siv::PerlinNoise temperatureNoise;
+    siv::PerlinNoise humidityNoise;
+    siv::PerlinNoise continentalNoise;
+    siv::PerlinNoise detailNoise;
+
+    std::unordered_map<int64_t, Region> regions;
+    std::deque<int64_t> regionOrder; // insertion order, for bounded cache
+
+    // last region looked up (columns of a chunk hit the same region repeatedly)
+    int64_t lastKey = 0;
+    const Region* lastRegion = nullptr;
+
+    const Region& region(int rx, int rz);
+    LatticePoint samplePoint(int wx, int wz) const;
+    // bilinear blend of the four lattice points around (wx, wz)
+    LatticePoint interpolate(int wx, int wz);
+};
@@ -1,39 +1,74 @@
 ﻿// Chunk.hpp
-// Represents a single chunk of voxels (columns of integer heights).
-// Provides a triangle mesh for visible faces and a separate "outline" line mesh
-// that draws black borders around faces for visual separation.
-//
-// To change border thickness globally: call Chunk::SetOutlineThickness(yourValue)
-// before rendering (or set it once in main after start).
+// Represents a single chunk of voxels (columns of integer heights, optionally
+// refined into a full voxel grid with overhangs and caves by DensityTerrain).
+// Terrain data only: no GL state, so the headless server can use it. The
+// renderable mesh of a chunk is a separate ChunkMesh.
 
 #pragma once
 #include <vector>
 #include <glm/glm.hpp>
 #include <cstdint>
+#include <cstddef>
+
+#include "BiomeMap.hpp"
+#include "HeightPyramid.hpp"
+
+class DensityTerrain;
 
 class Chunk {
 public:
     // ctor: originX/Z are world coordinates of the chunk's (0,0) corner.
-    Chunk(int originX, int originZ, int sizeX = 32, int sizeZ = 32);
-    ~Chunk();
+    // With a BiomeMap the terrain comes from GenerateHeightmapWithBiomes(),
+    // otherwise from the flat single-noise GenerateHeightmapWithPerlin().
+    // With a DensityTerrain the heightmap is then carved into voxels.
+    Chunk(int originX, int originZ, int sizeX = 32, int sizeZ = 32, BiomeMap* biomeMap = nullptr,
+        const DensityTerrain* density = nullptr);
 
-    // Generates a heightmap using Perlin noise (fills heights vector).
+    // Generates a heightmap using Perlin noise (fills heights vector) and
+    // rebuilds the min/max height pyramid.
     void GenerateHeightmapWithPerlin();
 
-    // BuildMesh populates meshData and outlineMeshData and uploads buffers.
-    void BuildMesh();
+    // Heights and per-column biomes from the shared climate layer, then
+    // rebuilds the height pyramid. Colours follow the column's biome palette.
+    void GenerateHeightmapWithBiomes(BiomeMap& biomeMap);
 
-    // Draws both filled triangles and outlines (calls glDrawArrays).
-    void Draw(unsigned int shaderProgram, const glm::mat4& view, const glm::mat4& projection);
+    // Runs the 3D density pass over the current heightmap and stores the
+    // result as voxels. heights then holds each column's topmost solid block + 1
+    // (an upper bound: caves below it are air), and the pyramid is rebuilt.
+    void GenerateDensityVoxels(const DensityTerrain& density);
 
     // Query: is there a solid block at world (x,y,z)?
     bool IsSolidAt(int worldX, int worldY, int worldZ) const;
+    // Same in chunk-local coords (out of range -> empty).
+    bool IsSolidLocal(int x, int y, int z) const;
 
     // Returns world (x,y,z) of every solid block's min-corner (useful for debug).
     std::vector<glm::vec3> GetSolidBlockPositions() const;
 
-    // Outline thickness control (pixels). Default value defined in Chunk.cpp.
-    static void SetOutlineThickness(float t);
+    // Sets or clears one block (chunk-local coords). A heightmap-only chunk is
+    // expanded to voxels first. Updates the column top and height pyramid.
+    // Returns false if out of range or nothing changed. Does not rebuild the mesh.
+    bool SetBlockLocal(int x, int y, int z, bool solid);
+
+    // Min/max mip pyramid over heights (for TerrainQuadtree queries/raycasts).
+    const HeightPyramid& GetHeightPyramid() const { return pyramid; }
+    int GetOriginX() const { return originX; }
+    int GetOriginZ() const { return originZ; }
+    int GetSizeX() const { return sizeX; }
+    int GetSizeZ() const { return sizeZ; }
+    int GetMaxHeight() const { return maxHeight; }
+
+    // Raw terrain data for serialization. Voxels may be empty (heightmap only),
+    // biomes are empty for the flat generator.
+    const std::vector<uint8_t>& GetVoxels() const { return voxels; }
+    const std::vector<Biome>& GetBiomes() const { return biomes; }
+    const std::vector<int>& GetHeights() const { return heights; }
+
+    // Bytes held by the terrain data (heights, biomes, voxels and pyramid).
+    size_t GetTerrainBytes() const;
+
+    // World-space center of the chunk footprint (used for upload priority).
+    glm::vec3 GetCenter() const;
 
 private:
     int originX, originZ;
@@ -41,11 +76,10 @@ private:
     int maxHeight;
 
     std::vector<int> heights;            // sizeX * sizeZ
-    std::vector<float> meshData;         // interleaved: pos(3) color(3) for filled triangles
-    std::vector<float> outlineMeshData;  // interleaved: pos(3) color(3) for line segments
-
-    unsigned int VAO = 0, VBO = 0;
-    unsigned int outlineVAO = 0, outlineVBO = 0;
+    HeightPyramid pyramid;               // built from heights
+    std::vector<Biome> biomes;           // sizeX * sizeZ, empty for the flat generator
+    std::vector<uint8_t> voxels;         // sizeX * sizeZ * maxHeight (x + sizeX * (z + sizeZ * y)), empty = heightmap only
 
-    void uploadMesh(); // uploads both VBOs/VAOs
+    // fills voxels from heights (used before the first edit of a heightmap chunk)
+    void expandToVoxels();
 };
@@ -0,0 +1,107 @@
+// ChunkCache.cpp
+// LRU-managed chunk storage with per-category memory accounting.
+
+#include "ChunkCache.hpp"
+#include "Chunk.hpp"
+#include "ChunkMesh.hpp"
+#include "UploadPipeline.hpp"
+
+#include <cstdio>
+
+// -----------------------------
+// Construction / Destruction
+// -----------------------------
+ChunkCache::ChunkCache(size_t budgetBytes, int chunkSize_, UploadPipeline* uploader_, uint32_t worldSeed)
+    : budget(budgetBytes), chunkSize(chunkSize_), uploader(uploader_), terrain(chunkSize_), biomeMap(worldSeed), density(worldSeed) {}
+
+ChunkCache::~ChunkCache() = default;
+
+// -----------------------------
+// Lookup / LRU
+// -----------------------------
+void ChunkCache::BeginFrame() { ++frame; }
+
+Chunk& ChunkCache::Get(int cx, int cz) { return *touch(cx, cz).chunk; }
+
+ChunkMesh& ChunkCache::GetMesh(int cx, int cz) { return *touch(cx, cz).mesh; }
+
+ChunkCache::Entry& ChunkCache::touch(int cx, int cz) {
+    int64_t k = GridKey(cx, cz);
+    auto it = entries.find(k);
+    if (it != entries.end()) {
+        Entry& e = it->second;
+        if (e.lastUsedFrame != frame) {
+            lru.splice(lru.begin(), lru, e.lruIt); // move to front
+            e.lastUsedFrame = frame;
+        }
+        return e;
+    }
+
+    // miss: generate (or regenerate after eviction) and queue its mesh
+    auto chunk = std::make_unique<Chunk>(cx * chunkSize, cz * chunkSize, chunkSize, chunkSize, &biomeMap, &density);
+    auto mesh = std::make_unique<ChunkMesh>(*chunk);
+    mesh->Build(uploader);
+    terrain.Insert(cx, cz, chunk.get());
+
+    lru.push_front(k);
+    Entry& e = entries[k];
+    e.chunk = std::move(chunk);
+    e.mesh = std::move(mesh);
+    e.lastUsedFrame = frame;
+    e.lruIt = lru.begin();
+    return e;
+}
+
+void ChunkCache::EnforceBudget() {
+    size_t total = Report().ChunkBytes();
+    while (total > budget && !lru.empty()) {
+        int64_t k = lru.back();
+        auto it = entries.find(k);
+        if (it->second.lastUsedFrame == frame) break; // everything left is in use
+
+        ChunkMesh::MemoryUsage usage = it->second.mesh->GetMemoryUsage();
+        total -= it->second.chunk->GetTerrainBytes() + usage.cpu + usage.gpu;
+
+        terrain.Remove(GridKeyX(k), GridKeyZ(k));
+        entries.erase(it);
+        lru.pop_back();
+        ++evictions;
+    }
+}
+
+void ChunkCache::RebuildMeshes() {
+    for (auto& entry : entries) entry.second.mesh->Build(uploader);
+}
+
+// -----------------------------
+// Reporting
+// -----------------------------
+MemoryReport ChunkCache::Report() const {
+    MemoryReport r;
+    for (const auto& entry : entries) {
+        ChunkMesh::MemoryUsage usage = entry.second.mesh->GetMemoryUsage();
+        const Chunk& chunk = *entry.second.chunk;
+        const size_t voxelBytes = chunk.GetVoxels().capacity() * sizeof(uint8_t);
+        r.voxelBytes += voxelBytes;
+        r.heightmapBytes += chunk.GetTerrainBytes() - voxelBytes;
+        r.cpuMeshBytes += usage.cpu;
+        r.gpuMeshBytes += usage.gpu;
+    }
+    r.stagingBytes = uploader ? uploader->RingBytes() : 0;
+    r.budgetBytes = budget;
+    r.residentChunks = entries.size();
+    r.evictions = evictions;
+    return r;
+}
+
+std::string MemoryReport::ToString() const {
+    auto mb = [](size_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); };
+    char buf[320];
+    std::snprintf(buf, sizeof(buf),
+        "chunks %zu | heightmap %.2f MB | voxels %.2f MB | cpu mesh %.2f MB | gpu mesh %.2f MB | "
+        "total %.2f / %.2f MB | staging %.2f MB | evictions %llu",
+        residentChunks, mb(heightmapBytes), mb(voxelBytes), mb(cpuMeshBytes), mb(gpuMeshBytes),
+        mb(ChunkBytes()), mb(budgetBytes), mb(stagingBytes),
+        static_cast<unsigned long long>(evictions));
+    return buf;
+}
@@ -0,0 +1,102 @@
+// ChunkCache.hpp
+// Owns the resident chunks, keyed by chunk grid coordinates, and keeps their
+// combined memory under a configurable budget.
+//
+// Get(cx, cz) returns the chunk (generating and meshing it on first use) and
+// marks it as used this frame; GetMesh(cx, cz) does the same for its
+// ChunkMesh. EnforceBudget() evicts the least recently used chunks that were
+// not touched this frame until the total fits. Terrain is a
+// pure function of world position, so an evicted chunk is simply regenerated
+// the next time it is requested. All chunks share one BiomeMap, so climate
+// lattice regions are sampled once and reused by neighbouring chunks. The
+// heightmaps are then carved into voxels (overhangs, caves) by DensityTerrain.
+//
+// Resident chunks' height pyramids are stitched into a TerrainQuadtree for
+// region-height queries and long-range raycasts (unloaded areas read as empty).
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "BiomeMap.hpp"
+#include "DensityTerrain.hpp"
+#include "GridCoords.hpp"
+#include "HeightPyramid.hpp"
+
+class Chunk;
+class ChunkMesh;
+class UploadPipeline;
+
+// Bytes by category, summed over resident chunks.
+struct MemoryReport {
+    size_t heightmapBytes = 0; // heights, biomes and height pyramids
+    size_t voxelBytes = 0;     // density voxels (most of a chunk's terrain)
+    size_t cpuMeshBytes = 0;  // mesh vectors not yet released (queued uploads)
+    size_t gpuMeshBytes = 0;  // VBO storage
+    size_t stagingBytes = 0;  // upload ring (fixed, not counted against the budget)
+    size_t budgetBytes = 0;
+    size_t residentChunks = 0;
+    uint64_t evictions = 0;
+
+    size_t ChunkBytes() const { return heightmapBytes + voxelBytes + cpuMeshBytes + gpuMeshBytes; }
+    std::string ToString() const;
+};
+
+class ChunkCache {
+public:
+    ChunkCache(size_t budgetBytes, int chunkSize = 32, UploadPipeline* uploader = nullptr, uint32_t worldSeed = 123456);
+    ~ChunkCache();
+
+    ChunkCache(const ChunkCache&) = delete;
+    ChunkCache& operator=(const ChunkCache&) = delete;
+
+    // Advances the LRU clock. Call once per frame before any Get().
+    void BeginFrame();
+
+    // Returns the chunk at grid (cx, cz), creating it if needed.
+    Chunk& Get(int cx, int cz);
+    ChunkMesh& GetMesh(int cx, int cz);
+
+    // Evicts cold chunks (LRU order) until ChunkBytes() <= budget.
+    // Chunks used in the current frame are never evicted.
+    void EnforceBudget();
+
+    // Rebuilds every resident chunk's mesh (e.g. after ChunkMesh::SetFaceRendering).
+    void RebuildMeshes();
+
+    void SetBudget(size_t bytes) { budget = bytes; }
+    size_t GetBudget() const { return budget; }
+    int GetChunkSize() const { return chunkSize; }
+    size_t ResidentCount() const { return entries.size(); }
+
+    MemoryReport Report() const;
+
+    const TerrainQuadtree& GetTerrain() const { return terrain; }
+    BiomeMap& GetBiomeMap() { return biomeMap; }
+
+private:
+    struct Entry {
+        std::unique_ptr<Chunk> chunk;
+        std::unique_ptr<ChunkMesh> mesh; // declared after chunk: destroyed first
+        uint64_t lastUsedFrame;
+        std::list<int64_t>::iterator lruIt;
+    };
+
+    size_t budget;
+    int chunkSize;
+    UploadPipeline* uploader;
+
+    uint64_t frame = 0;
+    uint64_t evictions = 0;
+    TerrainQuadtree terrain;
+    BiomeMap biomeMap;
+    DensityTerrain density;
+    std::list<int64_t> lru; // front = most recently used
+    std::unordered_map<int64_t, Entry> entries;
+
+    Entry& touch(int cx, int cz);
+};
@@ -0,0 +1,496 @@
+// ChunkMesh.cpp
+// Implementation of ChunkMesh. Builds a triangle mesh of only the visible
+// faces of a Chunk, plus a separate line mesh for outlines, and owns the GL
+// buffers they are uploaded to.
+//
+// The outline mesh contains pairs of vertices (line segments). The line color
+// is black (0,0,0) and thickness is configurable via SetOutlineThickness().
+//
+// In face rendering mode both meshes are replaced by one FaceRecord per face:
+// 4 bytes instead of 6 + 8 vertices of 24 bytes each.
+
+#include "ChunkMesh.hpp"
+#include "UploadPipeline.hpp"
+
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+// Layer colors indexed by y / 3 (simple banding)
+static const glm::vec3 layerColors[] = {
+    {0.0f, 0.2f, 0.7f},   // water
+    {0.9f, 0.85f, 0.6f},  // sand
+    {0.2f, 0.7f, 0.2f},   // grass
+    {0.45f,0.33f,0.21f},  // dirt
+    {0.5f,0.5f,0.5f},     // stone
+    {0.85f,0.85f,0.85f},  // rock
+    {1.0f,1.0f,1.0f}      // snow
+};
+
+// Adjustable outline thickness (pixels). Change using SetOutlineThickness().
+// Default: 1.5f
+static float g_outlineThickness = 0.00001f;
+void ChunkMesh::SetOutlineThickness(float t) { g_outlineThickness = t; }
+
+// Off by default: the face path is smaller on the GPU but has only been timed
+// on llvmpipe, where it draws up to 2.5x slower close up. F toggles it.
+static bool g_faceRendering = false;
+void ChunkMesh::SetFaceRendering(bool enabled) { g_faceRendering = enabled; }
+bool ChunkMesh::GetFaceRendering() { return g_faceRendering; }
+
+// 0 = GL_MAX_TEXTURE_BUFFER_SIZE, queried on first use
+static size_t g_faceRecordLimit = 0;
+void ChunkMesh::SetFaceRecordLimit(size_t records) { g_faceRecordLimit = records; }
+
+size_t ChunkMesh::faceRecordLimit() {
+    if (g_faceRecordLimit) return g_faceRecordLimit;
+    static const size_t maxTexels = [] {
+        GLint texels = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &texels);
+        return texels > 0 ? static_cast<size_t>(texels) : size_t(65536);
+        }();
+    return maxTexels;
+}
+
+static constexpr int kLayerColorCount = static_cast<int>(sizeof(layerColors) / sizeof(layerColors[0]));
+static constexpr int kBiomeBandCount = static_cast<int>(sizeof(BiomeInfo::layers) / sizeof(BiomeInfo::layers[0]));
+static constexpr int kFacePaletteSize = kLayerColorCount + static_cast<int>(Biome::Count) * kBiomeBandCount;
+
+static_assert(kFacePaletteSize <= ChunkMesh::FaceRecord::kMaxPaletteSize,
+    "face palette no longer fits u_Palette: grow it in the face shader and kMaxPaletteSize");
+static_assert(ChunkMesh::FaceRecord::kMaxPaletteSize <= (1 << ChunkMesh::FaceRecord::kColorBits),
+    "u_Palette is larger than a FaceRecord colour index can address");
+
+// layerColors first, then 7 bands per biome (same order as BiomeInfo::layers)
+const std::vector<glm::vec3>& ChunkMesh::GetFacePalette() {
+    static const std::vector<glm::vec3> palette = [] {
+        std::vector<glm::vec3> p(layerColors, layerColors + kLayerColorCount);
+        for (int b = 0; b < static_cast<int>(Biome::Count); ++b) {
+            const BiomeInfo& info = GetBiomeInfo(static_cast<Biome>(b));
+            p.insert(p.end(), info.layers, info.layers + kBiomeBandCount);
+        }
+        return p;
+        }();
+    return palette;
+}
+
+bool ChunkMesh::LoadFacePalette(unsigned int faceShaderProgram) {
+    const std::vector<glm::vec3>& palette = GetFacePalette();
+
+    // the linked length may differ from the source if the shader was edited
+    GLint declared = 0;
+    GLint uniformCount = 0;
+    glGetProgramiv(faceShaderProgram, GL_ACTIVE_UNIFORMS, &uniformCount);
+    for (GLint i = 0; i < uniformCount; ++i) {
+        char name[64];
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(faceShaderProgram, static_cast<GLuint>(i), sizeof(name), nullptr, &size, &type, name);
+        if (std::strcmp(name, "u_Palette") == 0 || std::strcmp(name, "u_Palette[0]") == 0) declared = size;
+    }
+    if (declared < static_cast<GLint>(palette.size())) {
+        std::cerr << "Face palette has " << palette.size() << " colours but u_Palette holds " << declared
+            << ": face rendering disabled\n";
+        return false;
+    }
+
+    glUseProgram(faceShaderProgram);
+    glUniform3fv(glGetUniformLocation(faceShaderProgram, "u_Palette"), static_cast<GLsizei>(palette.size()),
+        glm::value_ptr(palette[0]));
+    glUseProgram(0);
+    return true;
+}
+
+// -----------------------------
+// Construction / Destruction
+// -----------------------------
+ChunkMesh::ChunkMesh(const Chunk& chunk_) : chunk(chunk_) {}
+
+ChunkMesh::~ChunkMesh() {
+    if (uploader) uploader->Cancel(this);
+    if (VBO) glDeleteBuffers(1, &VBO);
+    if (VAO) glDeleteVertexArrays(1, &VAO);
+    if (outlineVBO) glDeleteBuffers(1, &outlineVBO);
+    if (outlineVAO) glDeleteVertexArrays(1, &outlineVAO);
+    if (faceVAO) glDeleteVertexArrays(1, &faceVAO);
+    if (faceTexture) glDeleteTextures(1, &faceTexture);
+}
+
+// -----------------------------
+// Vertex append helper (position(3) color(3))
+// -----------------------------
+static inline void appendVertex(std::vector<float>& dst, float px, float py, float pz, const glm::vec3& col) {
+    dst.push_back(px);
+    dst.push_back(py);
+    dst.push_back(pz);
+    dst.push_back(col.r);
+    dst.push_back(col.g);
+    dst.push_back(col.b);
+}
+
+// face triangle vertex offsets (6 verts per face; two triangles)
+static const float facePositions[6][18] = {
+    // +X
+    {0.5f,-0.5f,-0.5f,  0.5f, 0.5f,-0.5f,  0.5f, 0.5f, 0.5f,
+     0.5f, 0.5f, 0.5f,  0.5f,-0.5f, 0.5f,  0.5f,-0.5f,-0.5f},
+     // -X
+     {-0.5f,-0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f,-0.5f,
+      -0.5f, 0.5f,-0.5f, -0.5f,-0.5f,-0.5f, -0.5f,-0.5f, 0.5f},
+      // +Y (top)
+      {-0.5f, 0.5f,-0.5f,  0.5f, 0.5f,-0.5f,  0.5f, 0.5f, 0.5f,
+        0.5f, 0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f,-0.5f},
+        // -Y (bottom)
+        {-0.5f,-0.5f, 0.5f,  0.5f,-0.5f, 0.5f,  0.5f,-0.5f,-0.5f,
+          0.5f,-0.5f,-0.5f, -0.5f,-0.5f,-0.5f, -0.5f,-0.5f, 0.5f},
+          // +Z
+          {-0.5f,-0.5f, 0.5f,  0.5f,-0.5f, 0.5f,  0.5f, 0.5f, 0.5f,
+            0.5f, 0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f,-0.5f, 0.5f},
+            // -Z
+            {0.5f,-0.5f,-0.5f, -0.5f,-0.5f,-0.5f, -0.5f, 0.5f,-0.5f,
+             -0.5f, 0.5f,-0.5f,  0.5f, 0.5f,-0.5f,  0.5f,-0.5f,-0.5f}
+};
+
+// corners per face (4 unique corners) used to emit line segments.
+// facePositions uses corners 0,1,2, 2,3,0 of the same face; the face shader in
+// ChunkShaders.cpp carries a copy of this table, so keep the two in the same order.
+static const float faceCorners[6][12] = {
+    { 0.5f,-0.5f,-0.5f,  0.5f, 0.5f,-0.5f,  0.5f, 0.5f, 0.5f,  0.5f,-0.5f, 0.5f },
+    {-0.5f,-0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f,-0.5f, -0.5f,-0.5f,-0.5f},
+    {-0.5f, 0.5f,-0.5f,  0.5f, 0.5f,-0.5f,  0.5f, 0.5f, 0.5f, -0.5f, 0.5f, 0.5f },
+    {-0.5f,-0.5f, 0.5f,  0.5f,-0.5f, 0.5f,  0.5f,-0.5f,-0.5f, -0.5f,-0.5f,-0.5f},
+    {-0.5f,-0.5f, 0.5f,  0.5f,-0.5f, 0.5f,  0.5f, 0.5f, 0.5f, -0.5f, 0.5f, 0.5f },
+    { 0.5f,-0.5f,-0.5f, -0.5f,-0.5f,-0.5f, -0.5f, 0.5f,-0.5f,  0.5f, 0.5f,-0.5f }
+};
+
+// -----------------------------
+// Build mesh in the selected format, then queue or upload it.
+// -----------------------------
+void ChunkMesh::Build(UploadPipeline* pipeline) {
+    // records only have 6 bits for x/z and 8 for y
+    meshFaces = g_faceRendering && chunk.GetSizeX() <= FaceRecord::kMaxSizeXZ
+        && chunk.GetSizeZ() <= FaceRecord::kMaxSizeXZ && chunk.GetMaxHeight() <= FaceRecord::kMaxHeight;
+    emitFaces();
+
+    // the shader reads records through a buffer texture, which may be as small
+    // as 65536 texels (GL 3.3 minimum); mesh anything larger as vertices
+    if (meshFaces && faceData.size() > faceRecordLimit()) {
+        meshFaces = false;
+        emitFaces();
+    }
+
+    if (pipeline) {
+        pipeline->Enqueue(this);
+    }
+    else {
+        if (uploader) uploader->Cancel(this); // superseded by this direct upload
+        uploadMesh();
+    }
+}
+
+// -----------------------------
+// Fill faceData (meshFaces) or meshData + outlineMeshData: only emit faces
+// that are visible (neighbor missing), each with its outline segments.
+// -----------------------------
+void ChunkMesh::emitFaces() {
+    const int sizeX = chunk.GetSizeX(), sizeZ = chunk.GetSizeZ();
+    const int originX = chunk.GetOriginX(), originZ = chunk.GetOriginZ();
+    const std::vector<int>& heights = chunk.GetHeights();
+    const std::vector<Biome>& biomes = chunk.GetBiomes();
+
+    meshData.clear();
+    outlineMeshData.clear();
+    faceData.clear();
+
+    const std::vector<glm::vec3>& palette = GetFacePalette();
+
+    const glm::vec3 kBlack(0.0f, 0.0f, 0.0f);
+
+    for (int x = 0; x < sizeX; ++x) {
+        for (int z = 0; z < sizeZ; ++z) {
+            int h = heights[static_cast<size_t>(x) + static_cast<size_t>(z) * static_cast<size_t>(sizeX)];
+            for (int y = 0; y < h; ++y) {
+                if (!chunk.IsSolidLocal(x, y, z)) continue; // cave / overhang air below the column top
+
+                // neighbor presence (within chunk). Out-of-range considered empty -> face visible.
+                bool neighborPosX = chunk.IsSolidLocal(x + 1, y, z);
+                bool neighborNegX = chunk.IsSolidLocal(x - 1, y, z);
+                bool neighborPosZ = chunk.IsSolidLocal(x, y, z + 1);
+                bool neighborNegZ = chunk.IsSolidLocal(x, y, z - 1);
+                bool neighborPosY = chunk.IsSolidLocal(x, y + 1, z);
+                bool neighborNegY = chunk.IsSolidLocal(x, y - 1, z);
+
+                int colorIndex;
+                if (!biomes.empty()) {
+                    Biome biome = biomes[static_cast<size_t>(x) + static_cast<size_t>(z) * static_cast<size_t>(sizeX)];
+                    int band = std::min(kBiomeBandCount - 1, y / GetBiomeInfo(biome).bandHeight); // as BiomeLayerColor
+                    colorIndex = kLayerColorCount + static_cast<int>(biome) * kBiomeBandCount + band;
+                }
+                else {
+                    colorIndex = std::min(kLayerColorCount - 1, y / 3);
+                }
+                const glm::vec3& color = palette[static_cast<size_t>(colorIndex)];
+
+                // lambda to append a single face's triangles and its outline edges
+                auto emitFace = [&](int faceIdx) {
+                    if (meshFaces) {
+                        faceData.push_back(FaceRecord::Pack(x, y, z, faceIdx, colorIndex));
+                        return;
+                    }
+                    // triangles (6 vertices -> two tris)
+                    for (int v = 0; v < 6; ++v) {
+                        int base = v * 3;
+                        appendVertex(meshData,
+                            originX + x + facePositions[faceIdx][base + 0],
+                            static_cast<float>(y) + facePositions[faceIdx][base + 1],
+                            originZ + z + facePositions[faceIdx][base + 2],
+                            color);
+                    }
+                    // outline: 4 edges -> 4 line segments -> 8 vertices (pairs)
+                    for (int e = 0; e < 4; ++e) {
+                        int i0 = e;
+                        int i1 = (e + 1) % 4;
+                        int b0 = i0 * 3;
+                        int b1 = i1 * 3;
+                        appendVertex(outlineMeshData,
+                            originX + x + faceCorners[faceIdx][b0 + 0],
+                            static_cast<float>(y) + faceCorners[faceIdx][b0 + 1],
+                            originZ + z + faceCorners[faceIdx][b0 + 2],
+                            kBlack);
+                        appendVertex(outlineMeshData,
+                            originX + x + faceCorners[faceIdx][b1 + 0],
+                            static_cast<float>(y) + faceCorners[faceIdx][b1 + 1],
+                            originZ + z + faceCorners[faceIdx][b1 + 2],
+                            kBlack);
+                    }
+                    };
+
+                if (!neighborPosX) emitFace(0);
+                if (!neighborNegX) emitFace(1);
+                if (!neighborPosY) emitFace(2);
+                if (!neighborNegY) emitFace(3);
+                if (!neighborPosZ) emitFace(4);
+                if (!neighborNegZ) emitFace(5);
+            }
+        }
+    }
+}
+
+// -----------------------------
+// Create VAOs/VBOs on first use and grow their storage when a mesh no longer
+// fits. Storage never shrinks, so steady-state rebuilds only do sub-data copies
+// instead of reallocating in the driver.
+// -----------------------------
+static void growBuffer(unsigned int vbo, size_t& capacity, size_t needed) {
+    if (needed <= capacity) return;
+    size_t newCapacity = std::max(needed, capacity + capacity / 2);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(newCapacity), nullptr, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    capacity = newCapacity;
+}
+
+// empties a buffer whose contents are in the other mesh format
+static void resetBuffer(unsigned int vbo, size_t& capacity) {
+    if (capacity == 0) return;
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    capacity = 0;
+}
+
+static void createVertexArray(unsigned int& vao, unsigned int& vbo) {
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    // position(3) then color(3)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Face records are pulled by the shader (texelFetch on gl_VertexID / 6), so
+// the VAO has no attributes; core profile still needs one bound to draw.
+static void createFaceTexture(unsigned int& vao, unsigned int& texture, unsigned int vbo) {
+    glGenVertexArrays(1, &vao);
+    glGenTextures(1, &texture);
+
+    glBindTexture(GL_TEXTURE_BUFFER, texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, vbo);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
+
+void ChunkMesh::ensureBuffers(size_t meshBytes, size_t outlineBytes) {
+    if (VAO == 0) createVertexArray(VAO, VBO);
+    if (outlineVAO == 0) createVertexArray(outlineVAO, outlineVBO);
+    // only chunks uploaded as face records need the texture view of VBO
+    if (meshFaces && faceVAO == 0) createFaceTexture(faceVAO, faceTexture, VBO);
+
+    // format switch: drop storage sized for the other format so the savings show up
+    if (meshFaces != gpuFaces) {
+        resetBuffer(VBO, vboCapacity);
+        resetBuffer(outlineVBO, outlineVBOCapacity);
+    }
+    growBuffer(VBO, vboCapacity, meshBytes);
+    growBuffer(outlineVBO, outlineVBOCapacity, outlineBytes);
+}
+
+const void* ChunkMesh::meshDataPtr() const {
+    return meshFaces ? static_cast<const void*>(faceData.data()) : static_cast<const void*>(meshData.data());
+}
+
+size_t ChunkMesh::meshByteSize() const {
+    return meshFaces ? faceData.size() * sizeof(uint32_t) : meshData.size() * sizeof(float);
+}
+
+void ChunkMesh::setUploadedCounts() {
+    gpuFaces = meshFaces;
+    faceCount = static_cast<int>(faceData.size());
+    triVertexCount = static_cast<int>(meshData.size() / 6);
+    lineVertexCount = static_cast<int>(outlineMeshData.size() / 6);
+}
+
+// -----------------------------
+// Upload VBO/VAO for triangles and for outlines (synchronous path)
+// -----------------------------
+void ChunkMesh::uploadMesh() {
+    const size_t meshBytes = meshByteSize();
+    const size_t outlineBytes = outlineByteSize();
+    ensureBuffers(meshBytes, outlineBytes);
+
+    if (meshBytes) {
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(meshBytes), meshDataPtr());
+    }
+    if (outlineBytes) {
+        glBindBuffer(GL_ARRAY_BUFFER, outlineVBO);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(outlineBytes), outlineMeshData.data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    setUploadedCounts();
+    releaseCpuMesh();
+}
+
+// -----------------------------
+// Drop the CPU copy once it is on the GPU; Draw only needs the vertex counts.
+// swap() with an empty vector actually returns the allocation (clear() would not).
+// -----------------------------
+void ChunkMesh::releaseCpuMesh() {
+    std::vector<float>().swap(meshData);
+    std::vector<float>().swap(outlineMeshData);
+    std::vector<uint32_t>().swap(faceData);
+}
+
+// -----------------------------
+// Staged path: the mesh is already in srcBuffer (the UploadPipeline ring);
+// copy GPU-side into this chunk's VBOs.
+// -----------------------------
+void ChunkMesh::commitUpload(unsigned int srcBuffer, size_t meshOffset, size_t outlineOffset) {
+    const size_t meshBytes = meshByteSize();
+    const size_t outlineBytes = outlineByteSize();
+    ensureBuffers(meshBytes, outlineBytes);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, srcBuffer);
+    if (meshBytes) {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, VBO);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+            static_cast<GLintptr>(meshOffset), 0, static_cast<GLsizeiptr>(meshBytes));
+    }
+    if (outlineBytes) {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, outlineVBO);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+            static_cast<GLintptr>(outlineOffset), 0, static_cast<GLsizeiptr>(outlineBytes));
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+    setUploadedCounts();
+    releaseCpuMesh();
+}
+
+// -----------------------------
+// Draw both meshes: filled triangles first (polygon offset), then outlines (lines).
+// Outline thickness uses the static g_outlineThickness.
+// Face meshes expand each record to 6 triangle vertices, then 8 outline
+// vertices, both pulled from the same buffer.
+// -----------------------------
+void ChunkMesh::Draw(unsigned int shaderProgram, unsigned int faceShaderProgram, const glm::mat4& view,
+    const glm::mat4& projection) {
+    if (gpuFaces) {
+        drawFaces(faceShaderProgram, view, projection);
+        return;
+    }
+    if (triVertexCount == 0) return;
+
+    glUseProgram(shaderProgram);
+
+    glm::mat4 model = glm::mat4(1.0f);
+    glm::mat4 mvp = projection * view * model;
+    unsigned int mvpLoc = glGetUniformLocation(shaderProgram, "u_MVP");
+    glUniformMatrix4fv(mvpLoc, 1, GL_FALSE, glm::value_ptr(mvp));
+
+    // Draw filled geometry with polygon offset so lines sit cleanly on top
+    glEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(1.0f, 1.0f);
+
+    glBindVertexArray(VAO);
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(triVertexCount));
+    glBindVertexArray(0);
+
+    glDisable(GL_POLYGON_OFFSET_FILL);
+
+    // Draw outlines (lines)
+    if (lineVertexCount > 0) {
+        glBindVertexArray(outlineVAO);
+        // Set line width; some drivers clamp to 1.0. Pick a value you like via SetOutlineThickness()
+        glLineWidth(g_outlineThickness);
+        glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(lineVertexCount));
+        glBindVertexArray(0);
+    }
+}
+
+void ChunkMesh::drawFaces(unsigned int faceShaderProgram, const glm::mat4& view, const glm::mat4& projection) {
+    if (faceCount == 0) return;
+
+    glUseProgram(faceShaderProgram);
+
+    glm::mat4 mvp = projection * view;
+    glUniformMatrix4fv(glGetUniformLocation(faceShaderProgram, "u_MVP"), 1, GL_FALSE, glm::value_ptr(mvp));
+    glUniform3i(glGetUniformLocation(faceShaderProgram, "u_Origin"), chunk.GetOriginX(), 0, chunk.GetOriginZ());
+    int outlineLoc = glGetUniformLocation(faceShaderProgram, "u_Outline");
+
+    glUniform1i(glGetUniformLocation(faceShaderProgram, "u_Faces"), 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, faceTexture);
+    glBindVertexArray(faceVAO);
+
+    glEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(1.0f, 1.0f);
+    glUniform1i(outlineLoc, 0);
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(faceCount) * 6);
+    glDisable(GL_POLYGON_OFFSET_FILL);
+
+    glLineWidth(g_outlineThickness);
+    glUniform1i(outlineLoc, 1);
+    glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(faceCount) * 8);
+
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
+
+ChunkMesh::MemoryUsage ChunkMesh::GetMemoryUsage() const {
+    MemoryUsage usage;
+    usage.cpu = (meshData.capacity() + outlineMeshData.capacity()) * sizeof(float)
+        + faceData.capacity() * sizeof(uint32_t);
+    usage.gpu = vboCapacity + outlineVBOCapacity;
+    return usage;
+}
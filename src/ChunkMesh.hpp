@@ -0,0 +1,133 @@
+// ChunkMesh.hpp
+// Renderable mesh of one Chunk: a triangle mesh for visible faces and a
+// separate "outline" line mesh that draws black borders around faces for
+// visual separation, plus the GL buffers they live in. Client only; the
+// terrain itself (and everything the server needs) is in Chunk.
+//
+// With face rendering on (SetFaceRendering, off by default) the mesh is
+// instead one 32-bit record per visible face and the vertex shader expands it
+// into the quad and its outline (see FaceRecord below). The expanded vertex
+// path stays the default until the face path has been timed on real GPUs, and
+// is also used for chunks too large to pack or with more faces than a buffer
+// texture can hold.
+//
+// To change border thickness globally: call ChunkMesh::SetOutlineThickness(yourValue)
+// before rendering (or set it once in main after start).
+
+#pragma once
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Chunk.hpp"
+
+class UploadPipeline;
+
+class ChunkMesh {
+public:
+    // The chunk must outlive the mesh. Nothing is built until Build().
+    explicit ChunkMesh(const Chunk& chunk);
+    ~ChunkMesh();
+
+    ChunkMesh(const ChunkMesh&) = delete;
+    ChunkMesh& operator=(const ChunkMesh&) = delete;
+
+    // Build populates faceData (face rendering) or meshData and
+    // outlineMeshData from the chunk's current voxels. With no pipeline the
+    // buffers are uploaded immediately; otherwise the upload is queued and
+    // committed by pipeline->Update() within its per-frame budget.
+    void Build(UploadPipeline* pipeline = nullptr);
+
+    // Draws both filled triangles and outlines. Vertex meshes use shaderProgram
+    // (glDrawArrays); face meshes use faceShaderProgram, which expands each
+    // FaceRecord from gl_VertexID (no per-vertex attributes).
+    void Draw(unsigned int shaderProgram, unsigned int faceShaderProgram, const glm::mat4& view,
+        const glm::mat4& projection);
+
+    // Packed face record (one per visible face):
+    //   bits 0-5 x, 6-11 z, 12-19 y (chunk-local), 20-22 face direction
+    //   (+X -X +Y -Y +Z -Z), 23-31 index into GetFacePalette().
+    struct FaceRecord {
+        static constexpr int kMaxSizeXZ = 64;
+        static constexpr int kMaxHeight = 256;
+        static constexpr int kColorBits = 9;
+        // length of u_Palette in the face shader (ChunkShaders.cpp; keep the two in sync)
+        static constexpr int kMaxPaletteSize = 64;
+        static uint32_t Pack(int x, int y, int z, int face, int colorIndex) {
+            return static_cast<uint32_t>(x) | (static_cast<uint32_t>(z) << 6) | (static_cast<uint32_t>(y) << 12)
+                | (static_cast<uint32_t>(face) << 20) | (static_cast<uint32_t>(colorIndex) << 23);
+        }
+    };
+
+    // Colours addressed by FaceRecord: the flat generator's layer bands, then
+    // every biome's 7 bands. The face shader's u_Palette must be loaded from it.
+    static const std::vector<glm::vec3>& GetFacePalette();
+
+    // Uploads GetFacePalette() into faceShaderProgram's u_Palette. Returns false
+    // (and leaves face rendering unusable) if the linked array is too short.
+    static bool LoadFacePalette(unsigned int faceShaderProgram);
+
+    const Chunk& GetChunk() const { return chunk; }
+
+    // Bytes held by this mesh. CPU mesh vectors are released as soon as the
+    // mesh reaches the GPU, so cpu is non-zero only while an upload is queued.
+    struct MemoryUsage {
+        size_t cpu = 0;
+        size_t gpu = 0;
+    };
+    MemoryUsage GetMemoryUsage() const;
+
+    // Outline thickness control (pixels). Default value defined in ChunkMesh.cpp.
+    static void SetOutlineThickness(float t);
+
+    // Selects the mesh format for subsequent Build() calls. Meshes already on
+    // the GPU keep drawing in their old format until rebuilt.
+    static void SetFaceRendering(bool enabled);
+    static bool GetFaceRendering();
+
+    // Chunks with more visible faces than this are meshed as vertices even
+    // with face rendering on. 0 (the default) uses GL_MAX_TEXTURE_BUFFER_SIZE;
+    // a smaller value exercises the fallback.
+    static void SetFaceRecordLimit(size_t records);
+
+private:
+    friend class UploadPipeline;
+
+    const Chunk& chunk;
+
+    std::vector<float> meshData;         // interleaved: pos(3) color(3) for filled triangles (freed after upload)
+    std::vector<float> outlineMeshData;  // interleaved: pos(3) color(3) for line segments (freed after upload)
+    std::vector<uint32_t> faceData;      // FaceRecord per visible face (freed after upload)
+    bool meshFaces = false;              // the CPU mesh being built/queued is faceData
+
+    unsigned int VAO = 0, VBO = 0;
+    unsigned int outlineVAO = 0, outlineVBO = 0;
+    unsigned int faceVAO = 0;            // attribute-less VAO for face draws
+    unsigned int faceTexture = 0;        // GL_R32UI buffer texture over VBO when it holds face records
+    size_t vboCapacity = 0, outlineVBOCapacity = 0; // allocated GPU bytes (grow-only per format)
+
+    // what is currently on the GPU (may lag a queued rebuild)
+    bool gpuFaces = false;
+    int triVertexCount = 0;
+    int lineVertexCount = 0;
+    int faceCount = 0;
+
+    UploadPipeline* uploader = nullptr; // set while an upload is queued
+
+    void emitFaces(); // fills faceData or meshData/outlineMeshData per meshFaces
+    static size_t faceRecordLimit();
+
+    // CPU mesh as uploaded/staged: vertices or face records, then outline vertices
+    const void* meshDataPtr() const;
+    size_t meshByteSize() const;
+    size_t outlineByteSize() const { return outlineMeshData.size() * sizeof(float); }
+
+    void ensureBuffers(size_t meshBytes, size_t outlineBytes);
+    void setUploadedCounts();
+    void drawFaces(unsigned int faceShaderProgram, const glm::mat4& view, const glm::mat4& projection);
+    void releaseCpuMesh();
+    void uploadMesh(); // uploads both VBOs/VAOs synchronously
+    // copies already-staged mesh/outline bytes out of srcBuffer into the VBOs
+    void commitUpload(unsigned int srcBuffer, size_t meshOffset, size_t outlineOffset);
+};
@@ -0,0 +1,132 @@
+// ChunkShaders.cpp
+// GLSL sources for the two chunk programs and the compile/link helpers.
+
+#include "ChunkShaders.hpp"
+
+#include <glad/glad.h>
+
+#include <iostream>
+
+// -----------------------------
+// Minimal shader sources (position + color)
+// -----------------------------
+static const char* const vertexShaderSource = R"glsl(
+#version 330 core
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec3 aColor;
+out vec3 vColor;
+uniform mat4 u_MVP;
+void main() {
+    vColor = aColor;
+    gl_Position = u_MVP * vec4(aPos, 1.0);
+}
+)glsl";
+
+static const char* const fragmentShaderSource = R"glsl(
+#version 330 core
+in vec3 vColor;
+out vec4 FragColor;
+void main() {
+    FragColor = vec4(vColor, 1.0);
+}
+)glsl";
+
+// -----------------------------
+// Face shader: no vertex attributes. gl_VertexID selects the FaceRecord
+// (6 vertices per face for triangles, 8 for outline segments) and its corner;
+// kCorners mirrors faceCorners in ChunkMesh.cpp.
+// -----------------------------
+static const char* const faceVertexShaderSource = R"glsl(
+#version 330 core
+out vec3 vColor;
+uniform usamplerBuffer u_Faces;
+uniform mat4 u_MVP;
+uniform ivec3 u_Origin;
+uniform bool u_Outline;
+uniform vec3 u_Palette[64]; // ChunkMesh::FaceRecord::kMaxPaletteSize
+
+const vec3 kCorners[24] = vec3[24](
+    vec3( 0.5,-0.5,-0.5), vec3( 0.5, 0.5,-0.5), vec3( 0.5, 0.5, 0.5), vec3( 0.5,-0.5, 0.5),
+    vec3(-0.5,-0.5, 0.5), vec3(-0.5, 0.5, 0.5), vec3(-0.5, 0.5,-0.5), vec3(-0.5,-0.5,-0.5),
+    vec3(-0.5, 0.5,-0.5), vec3( 0.5, 0.5,-0.5), vec3( 0.5, 0.5, 0.5), vec3(-0.5, 0.5, 0.5),
+    vec3(-0.5,-0.5, 0.5), vec3( 0.5,-0.5, 0.5), vec3( 0.5,-0.5,-0.5), vec3(-0.5,-0.5,-0.5),
+    vec3(-0.5,-0.5, 0.5), vec3( 0.5,-0.5, 0.5), vec3( 0.5, 0.5, 0.5), vec3(-0.5, 0.5, 0.5),
+    vec3( 0.5,-0.5,-0.5), vec3(-0.5,-0.5,-0.5), vec3(-0.5, 0.5,-0.5), vec3( 0.5, 0.5,-0.5));
+const int kTriangleCorner[6] = int[6](0, 1, 2, 2, 3, 0);
+const int kLineCorner[8] = int[8](0, 1, 1, 2, 2, 3, 3, 0);
+
+void main() {
+    int perFace = u_Outline ? 8 : 6;
+    uint record = texelFetch(u_Faces, gl_VertexID / perFace).r;
+    int vertex = gl_VertexID % perFace;
+
+    ivec3 local = ivec3(int(record & 63u), int((record >> 12) & 255u), int((record >> 6) & 63u));
+    int face = int((record >> 20) & 7u);
+    int corner = u_Outline ? kLineCorner[vertex] : kTriangleCorner[vertex];
+
+    vColor = u_Outline ? vec3(0.0) : u_Palette[record >> 23];
+    gl_Position = u_MVP * vec4(vec3(u_Origin + local) + kCorners[face * 4 + corner], 1.0);
+}
+)glsl";
+
+static const char* const faceFragmentShaderSource = R"glsl(
+#version 330 core
+in vec3 vColor;
+out vec4 FragColor;
+void main() {
+    FragColor = vec4(vColor, 1.0);
+}
+)glsl";
+
+// -----------------------------
+// Helper: compile shader
+// -----------------------------
+static unsigned int CompileShader(GLenum type, const char* src) {
+    unsigned int sh = glCreateShader(type);
+    glShaderSource(sh, 1, &src, nullptr);
+    glCompileShader(sh);
+
+    int ok = 0;
+    glGetShaderiv(sh, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetShaderInfoLog(sh, 1024, nullptr, log);
+        std::cerr << "Shader compile error: " << log << "\n";
+    }
+    return sh;
+}
+
+// -----------------------------
+// Helper: compile + link a vertex/fragment pair
+// -----------------------------
+static unsigned int LinkProgram(const char* vertexSrc, const char* fragmentSrc) {
+    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexSrc);
+    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentSrc);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+
+    // Check link status
+    int ok = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetProgramInfoLog(program, 1024, nullptr, log);
+        std::cerr << "Program link error: " << log << "\n";
+    }
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    return program;
+}
+
+// -----------------------------
+// Public entry points
+// -----------------------------
+unsigned int CreateChunkShaderProgram() {
+    return LinkProgram(vertexShaderSource, fragmentShaderSource);
+}
+
+unsigned int CreateFaceShaderProgram() {
+    return LinkProgram(faceVertexShaderSource, faceFragmentShaderSource);
+}
@@ -0,0 +1,15 @@
+// ChunkShaders.hpp
+// The GLSL programs ChunkMesh::Draw expects, shared by the game and the
+// offscreen render comparison so both draw with the same shaders.
+//
+// Both need a current GL 3.3 context. Compile/link errors are printed to
+// stderr; the returned program is then unusable.
+
+#pragma once
+
+// Per-vertex meshes: position(3) colour(3) attributes, uniform u_MVP.
+unsigned int CreateChunkShaderProgram();
+
+// Face-record meshes: no attributes; records come from the u_Faces buffer
+// texture and colours from u_Palette (load it with ChunkMesh::LoadFacePalette).
+unsigned int CreateFaceShaderProgram();
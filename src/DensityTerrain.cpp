@@ -0,0 +1,143 @@
+// DensityTerrain.cpp
+// Coarse-lattice 3D noise with trilinear interpolation (and a full-resolution
+// reference path that shares the same density rule).
+
+#include "DensityTerrain.hpp"
+
+#include <algorithm>
+
+// -----------------------------
+// Construction / noise fields
+// -----------------------------
+DensityTerrain::DensityTerrain(uint32_t seed)
+    : shapeNoise(seed + 11), caveNoise(seed + 12) {}
+
+// octave3D sums octaves of amplitude 1, 0.5, 0.25, ... (each noise in [-1, 1]),
+// so its bound is the sum of those amplitudes, not 1
+static const int kShapeOctaves = 3;
+static constexpr double octaveBound(int octaves) { return octaves > 0 ? 1.0 + 0.5 * octaveBound(octaves - 1) : 0.0; }
+
+// (surface - y) + shape * kShapeAmplitude <= 0 for every y >= surface + kShapeReach
+static const int kShapeReach = static_cast<int>(DensityTerrain::kShapeAmplitude * octaveBound(kShapeOctaves)) + 1;
+
+double DensityTerrain::shapeAt(double wx, double y, double wz) const {
+    return shapeNoise.octave3D(wx / 24.0, y / 16.0, wz / 24.0, kShapeOctaves); // within +-octaveBound(3) = 1.75
+}
+
+double DensityTerrain::caveAt(double wx, double y, double wz) const {
+    return caveNoise.octave3D(wx / 32.0, y / 20.0, wz / 32.0, 2);
+}
+
+// -----------------------------
+// Density rule (shared by both paths)
+// -----------------------------
+bool DensityTerrain::isSolid(int surfaceHeight, int y, double shape, double cave) {
+    double density = static_cast<double>(surfaceHeight - y) + shape * kShapeAmplitude;
+    if (density <= 0.0) return false;
+    // keep a floor at y = 0 and a crust under the surface so caves rarely
+    // turn the whole top layer into holes
+    if (y >= 1 && y < surfaceHeight - 3 && cave > kCaveThreshold) return false;
+    return true;
+}
+
+// -----------------------------
+// Coarse lattice + trilinear interpolation
+// -----------------------------
+size_t DensityTerrain::Fill(int originX, int originZ, int sizeX, int sizeZ, int sizeY,
+    const std::vector<int>& surface, std::vector<uint8_t>& voxels) const {
+    // nothing kShapeReach or more above the tallest column can be solid, so the
+    // lattice only needs to reach that high (interpolated values stay within
+    // the lattice bound)
+    int maxSurface = 0;
+    for (int h : surface) maxSurface = std::max(maxSurface, h);
+    const int top = std::min(sizeY, maxSurface + kShapeReach);
+
+    // lattice points cover [0, size] inclusive so the last voxel has a far corner
+    const int lx = (sizeX + kStepXZ - 1) / kStepXZ + 1;
+    const int ly = (top + kStepY - 1) / kStepY + 1;
+    const int lz = (sizeZ + kStepXZ - 1) / kStepXZ + 1;
+
+    std::vector<float> shape(static_cast<size_t>(lx) * ly * lz);
+    std::vector<float> cave(shape.size());
+    auto lidx = [&](int x, int y, int z) { return static_cast<size_t>(x) + static_cast<size_t>(lx) * (static_cast<size_t>(z) + static_cast<size_t>(lz) * y); };
+
+    for (int y = 0; y < ly; ++y) {
+        for (int z = 0; z < lz; ++z) {
+            for (int x = 0; x < lx; ++x) {
+                double wx = originX + x * kStepXZ;
+                double wy = y * kStepY;
+                double wz = originZ + z * kStepXZ;
+                shape[lidx(x, y, z)] = static_cast<float>(shapeAt(wx, wy, wz));
+                cave[lidx(x, y, z)] = static_cast<float>(caveAt(wx, wy, wz));
+            }
+        }
+    }
+
+    voxels.assign(static_cast<size_t>(sizeX) * sizeZ * sizeY, 0);
+
+    // Trilinear interpolation done separably: lerp the lattice along y once per
+    // voxel layer, then along z once per row, so each voxel only lerps along x.
+    std::vector<float> shapeSlice(static_cast<size_t>(lx) * lz), caveSlice(shapeSlice.size());
+    std::vector<float> shapeRow(static_cast<size_t>(lx)), caveRow(shapeRow.size());
+
+    for (int y = 0; y < top; ++y) {
+        const int cy = y / kStepY;
+        const float fy = static_cast<float>(y - cy * kStepY) / kStepY;
+        for (size_t i = 0; i < shapeSlice.size(); ++i) {
+            size_t lo = i + static_cast<size_t>(cy) * shapeSlice.size();
+            size_t hi = lo + shapeSlice.size();
+            shapeSlice[i] = shape[lo] + (shape[hi] - shape[lo]) * fy;
+            caveSlice[i] = cave[lo] + (cave[hi] - cave[lo]) * fy;
+        }
+
+        for (int z = 0; z < sizeZ; ++z) {
+            const int cz = z / kStepXZ;
+            const float fz = static_cast<float>(z - cz * kStepXZ) / kStepXZ;
+            for (int x = 0; x < lx; ++x) {
+                size_t lo = static_cast<size_t>(x) + static_cast<size_t>(cz) * lx;
+                size_t hi = lo + lx;
+                shapeRow[x] = shapeSlice[lo] + (shapeSlice[hi] - shapeSlice[lo]) * fz;
+                caveRow[x] = caveSlice[lo] + (caveSlice[hi] - caveSlice[lo]) * fz;
+            }
+
+            for (int x = 0; x < sizeX; ++x) {
+                const int h = surface[static_cast<size_t>(x) + static_cast<size_t>(z) * sizeX];
+                // far above the surface nothing can be solid: skip the interpolation
+                if (y >= h + kShapeReach) continue;
+
+                const int cx = x / kStepXZ;
+                const float fx = static_cast<float>(x - cx * kStepXZ) / kStepXZ;
+                float sv = shapeRow[cx] + (shapeRow[cx + 1] - shapeRow[cx]) * fx;
+                float cv = caveRow[cx] + (caveRow[cx + 1] - caveRow[cx]) * fx;
+
+                if (isSolid(h, y, sv, cv))
+                    voxels[static_cast<size_t>(x) + static_cast<size_t>(sizeX) * (static_cast<size_t>(z) + static_cast<size_t>(sizeZ) * y)] = 1;
+            }
+        }
+    }
+    return shape.size();
+}
+
+// -----------------------------
+// Full-resolution reference
+// -----------------------------
+size_t DensityTerrain::FillFullResolution(int originX, int originZ, int sizeX, int sizeZ, int sizeY,
+    const std::vector<int>& surface, std::vector<uint8_t>& voxels) const {
+    voxels.assign(static_cast<size_t>(sizeX) * sizeZ * sizeY, 0);
+    size_t samples = 0;
+
+    for (int y = 0; y < sizeY; ++y) {
+        for (int z = 0; z < sizeZ; ++z) {
+            for (int x = 0; x < sizeX; ++x) {
+                const int h = surface[static_cast<size_t>(x) + static_cast<size_t>(z) * sizeX];
+                if (y >= h + kShapeReach) continue;
+
+                double wx = originX + x, wz = originZ + z;
+                ++samples;
+                if (isSolid(h, y, shapeAt(wx, y, wz), caveAt(wx, y, wz)))
+                    voxels[static_cast<size_t>(x) + static_cast<size_t>(sizeX) * (static_cast<size_t>(z) + static_cast<size_t>(sizeZ) * y)] = 1;
+            }
+        }
+    }
+    return samples;
+}
@@ -0,0 +1,47 @@
+// DensityTerrain.hpp
+// 3D density pass that turns a column heightmap into voxels with overhangs
+// and caves.
+//
+// A voxel is solid when (surface - y) + shape noise * kShapeAmplitude > 0, and
+// it is carved out again when the cave noise exceeds kCaveThreshold. Both noise
+// fields use siv::PerlinNoise::octave3D, but they are only evaluated on a
+// coarse lattice (every kStepXZ x kStepY x kStepXZ voxels) and trilinearly
+// interpolated in between. The surface term is exact per column, so the coarse
+// lattice only smooths the perturbation, not the terrain height itself.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "PerlinNoise.hpp"
+
+class DensityTerrain {
+public:
+    static const int kStepXZ = 4;             // lattice spacing along x/z
+    static const int kStepY = 8;              // lattice spacing along y
+    static constexpr double kShapeAmplitude = 6.0;
+    static constexpr double kCaveThreshold = 0.22;
+
+    explicit DensityTerrain(uint32_t seed = 123456);
+
+    // Fills voxels for a chunk. surface is the chunk's column heightmap
+    // (x + z * sizeX); voxels is resized to sizeX * sizeZ * sizeY and indexed
+    // x + sizeX * (z + sizeZ * y), 1 = solid. Returns the number of points at
+    // which the noise fields were sampled (lattice points).
+    size_t Fill(int originX, int originZ, int sizeX, int sizeZ, int sizeY,
+        const std::vector<int>& surface, std::vector<uint8_t>& voxels) const;
+
+    // Same output, but evaluates both noise fields at every voxel. Only meant
+    // as a quality/cost reference for Fill(). Returns the voxels sampled.
+    size_t FillFullResolution(int originX, int originZ, int sizeX, int sizeZ, int sizeY,
+        const std::vector<int>& surface, std::vector<uint8_t>& voxels) const;
+
+private:
+    siv::PerlinNoise shapeNoise;
+    siv::PerlinNoise caveNoise;
+
+    double shapeAt(double wx, double y, double wz) const;
+    double caveAt(double wx, double y, double wz) const;
+    static bool isSolid(int surfaceHeight, int y, double shape, double cave);
+};
@@ -0,0 +1,21 @@
+// GridCoords.hpp
+// Integer helpers shared by everything that keys data on a 2D grid (chunks,
+// climate regions, quadtree nodes).
+//
+// Grid coordinates may be negative, so cell lookups use floor division rather
+// than C++'s truncating '/', and map keys pack both coordinates into 64 bits.
+
+#pragma once
+#include <cstdint>
+
+// Floor of v / d for d > 0 (rounds towards -infinity, unlike '/').
+inline int FloorDiv(int v, int d) {
+    return (v >= 0 ? v : v - d + 1) / d;
+}
+
+// Packs (x, z) into one hash-map key; GridKeyX/GridKeyZ unpack it.
+inline int64_t GridKey(int x, int z) {
+    return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(z);
+}
+inline int GridKeyX(int64_t key) { return static_cast<int>(key >> 32); }
+inline int GridKeyZ(int64_t key) { return static_cast<int>(static_cast<uint32_t>(key)); }
@@ -0,0 +1,246 @@
+// HeightPyramid.cpp
+// Implementation of HeightPyramid (per chunk) and TerrainQuadtree (world).
+//
+// Node coordinates use arithmetic right shifts (floor division by a power of
+// two), so negative world/chunk coordinates map to the correct parent nodes.
+
+#include "HeightPyramid.hpp"
+#include "Chunk.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// -----------------------------
+// HeightPyramid
+// -----------------------------
+void HeightPyramid::Build(const std::vector<int>& heights, int sizeX, int sizeZ) {
+    size = 1;
+    while (size < sizeX || size < sizeZ) size <<= 1;
+
+    levels.clear();
+    levels.emplace_back(static_cast<size_t>(size) * static_cast<size_t>(size)); // padding stays empty
+    for (int z = 0; z < sizeZ; ++z) {
+        for (int x = 0; x < sizeX; ++x) {
+            int h = heights[static_cast<size_t>(x) + static_cast<size_t>(z) * static_cast<size_t>(sizeX)];
+            levels[0][static_cast<size_t>(x) + static_cast<size_t>(z) * static_cast<size_t>(size)] = HeightRange{ h, h };
+        }
+    }
+
+    // each level merges 2x2 nodes of the one below
+    for (int s = size / 2; s >= 1; s /= 2) {
+        const std::vector<HeightRange>& below = levels.back();
+        const int bs = s * 2;
+        std::vector<HeightRange> level(static_cast<size_t>(s) * static_cast<size_t>(s));
+        for (int z = 0; z < s; ++z) {
+            for (int x = 0; x < s; ++x) {
+                HeightRange r;
+                r.Merge(below[static_cast<size_t>(2 * x) + static_cast<size_t>(2 * z) * bs]);
+                r.Merge(below[static_cast<size_t>(2 * x + 1) + static_cast<size_t>(2 * z) * bs]);
+                r.Merge(below[static_cast<size_t>(2 * x) + static_cast<size_t>(2 * z + 1) * bs]);
+                r.Merge(below[static_cast<size_t>(2 * x + 1) + static_cast<size_t>(2 * z + 1) * bs]);
+                level[static_cast<size_t>(x) + static_cast<size_t>(z) * s] = r;
+            }
+        }
+        levels.push_back(std::move(level));
+    }
+}
+
+HeightRange HeightPyramid::Node(int level, int nx, int nz) const {
+    if (level < 0 || level >= Levels()) return HeightRange{};
+    int s = size >> level;
+    if (nx < 0 || nz < 0 || nx >= s || nz >= s) return HeightRange{};
+    return levels[level][static_cast<size_t>(nx) + static_cast<size_t>(nz) * static_cast<size_t>(s)];
+}
+
+HeightRange HeightPyramid::Query(int x0, int z0, int x1, int z1) const {
+    HeightRange acc;
+    if (levels.empty()) return acc;
+    x0 = std::max(x0, 0); z0 = std::max(z0, 0);
+    x1 = std::min(x1, size - 1); z1 = std::min(z1, size - 1);
+    if (x0 > x1 || z0 > z1) return acc;
+    queryNode(Levels() - 1, 0, 0, x0, z0, x1, z1, acc);
+    return acc;
+}
+
+void HeightPyramid::queryNode(int level, int nx, int nz, int x0, int z0, int x1, int z1, HeightRange& acc) const {
+    int nx0 = nx << level, nz0 = nz << level;
+    int nx1 = nx0 + (1 << level) - 1, nz1 = nz0 + (1 << level) - 1;
+    if (nx1 < x0 || nx0 > x1 || nz1 < z0 || nz0 > z1) return;
+
+    HeightRange r = Node(level, nx, nz);
+    if (r.IsEmpty()) return;
+    if (nx0 >= x0 && nx1 <= x1 && nz0 >= z0 && nz1 <= z1) {
+        acc.Merge(r); // fully covered: no need to descend
+        return;
+    }
+    for (int i = 0; i < 4; ++i)
+        queryNode(level - 1, nx * 2 + (i & 1), nz * 2 + (i >> 1), x0, z0, x1, z1, acc);
+}
+
+size_t HeightPyramid::ByteSize() const {
+    size_t total = 0;
+    for (const auto& level : levels) total += level.capacity() * sizeof(HeightRange);
+    return total;
+}
+
+// -----------------------------
+// TerrainQuadtree: construction / updates
+// -----------------------------
+TerrainQuadtree::TerrainQuadtree(int chunkSize, int worldLevels) : chunkShift(0) {
+    while ((1 << chunkShift) < chunkSize) ++chunkShift;
+    topLevel = chunkShift + worldLevels;
+    worldNodes.resize(static_cast<size_t>(worldLevels) + 1);
+}
+
+void TerrainQuadtree::Insert(int cx, int cz, const Chunk* chunk) {
+    chunks[GridKey(cx, cz)] = chunk;
+    refreshAncestors(cx, cz);
+}
+
+void TerrainQuadtree::Remove(int cx, int cz) {
+    if (chunks.erase(GridKey(cx, cz)) == 0) return;
+    refreshAncestors(cx, cz);
+}
+
+void TerrainQuadtree::refreshAncestors(int cx, int cz) {
+    auto cit = chunks.find(GridKey(cx, cz));
+    if (cit != chunks.end() && !cit->second->GetHeightPyramid().Root().IsEmpty())
+        worldNodes[0][GridKey(cx, cz)] = cit->second->GetHeightPyramid().Root();
+    else
+        worldNodes[0].erase(GridKey(cx, cz));
+
+    for (size_t k = 1; k < worldNodes.size(); ++k) {
+        int px = cx >> k, pz = cz >> k;
+        HeightRange r;
+        for (int i = 0; i < 4; ++i) {
+            auto it = worldNodes[k - 1].find(GridKey(px * 2 + (i & 1), pz * 2 + (i >> 1)));
+            if (it != worldNodes[k - 1].end()) r.Merge(it->second);
+        }
+        if (r.IsEmpty()) worldNodes[k].erase(GridKey(px, pz));
+        else worldNodes[k][GridKey(px, pz)] = r;
+    }
+}
+
+HeightRange TerrainQuadtree::nodeRange(int g, int nx, int nz) const {
+    if (g >= chunkShift) {
+        const auto& level = worldNodes[static_cast<size_t>(g - chunkShift)];
+        auto it = level.find(GridKey(nx, nz));
+        return it != level.end() ? it->second : HeightRange{};
+    }
+    // inside a chunk: defer to its pyramid
+    int shift = chunkShift - g;
+    int cx = nx >> shift, cz = nz >> shift;
+    auto it = chunks.find(GridKey(cx, cz));
+    if (it == chunks.end()) return HeightRange{};
+    return it->second->GetHeightPyramid().Node(g, nx - (cx << shift), nz - (cz << shift));
+}
+
+// -----------------------------
+// Region queries
+// -----------------------------
+HeightRange TerrainQuadtree::Query(int x0, int z0, int x1, int z1) const {
+    HeightRange acc;
+    if (x0 > x1 || z0 > z1) return acc;
+    for (int nz = z0 >> topLevel; nz <= (z1 >> topLevel); ++nz)
+        for (int nx = x0 >> topLevel; nx <= (x1 >> topLevel); ++nx)
+            queryNode(topLevel, nx, nz, x0, z0, x1, z1, acc);
+    return acc;
+}
+
+void TerrainQuadtree::queryNode(int g, int nx, int nz, int x0, int z0, int x1, int z1, HeightRange& acc) const {
+    int64_t nx0 = static_cast<int64_t>(nx) << g, nz0 = static_cast<int64_t>(nz) << g;
+    int64_t nx1 = nx0 + (int64_t(1) << g) - 1, nz1 = nz0 + (int64_t(1) << g) - 1;
+    if (nx1 < x0 || nx0 > x1 || nz1 < z0 || nz0 > z1) return;
+
+    HeightRange r = nodeRange(g, nx, nz);
+    if (r.IsEmpty()) return; // nothing loaded below this node
+    if (nx0 >= x0 && nx1 <= x1 && nz0 >= z0 && nz1 <= z1) {
+        acc.Merge(r);
+        return;
+    }
+    for (int i = 0; i < 4; ++i)
+        queryNode(g - 1, nx * 2 + (i & 1), nz * 2 + (i >> 1), x0, z0, x1, z1, acc);
+}
+
+int TerrainQuadtree::HighestBlockY(int x0, int z0, int x1, int z1) const {
+    HeightRange r = Query(x0, z0, x1, z1);
+    if (r.IsEmpty() || r.max <= 0) return -1;
+    return r.max - 1;
+}
+
+// -----------------------------
+// Ray marching
+// -----------------------------
+bool TerrainQuadtree::Raycast(const glm::vec3& origin, const glm::vec3& dir, float maxDistance, RayHit& hit) const {
+    return march(origin, dir, maxDistance, topLevel, hit);
+}
+
+bool TerrainQuadtree::RaycastPerCell(const glm::vec3& origin, const glm::vec3& dir, float maxDistance, RayHit& hit) const {
+    return march(origin, dir, maxDistance, 0, hit);
+}
+
+bool TerrainQuadtree::march(const glm::vec3& origin, const glm::vec3& dir, float maxDistance, int maxLevel, RayHit& hit) const {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double eps = 1e-6;
+    const double ox = origin.x, oy = origin.y, oz = origin.z;
+    const double dx = dir.x, dy = dir.y, dz = dir.z;
+    const double tMax = maxDistance;
+
+    double t = 0.0;
+    int level = maxLevel;
+    while (t <= tMax) {
+        const int bx = static_cast<int>(std::floor(ox + dx * t));
+        const int bz = static_cast<int>(std::floor(oz + dz * t));
+        const int nx = bx >> level, nz = bz >> level;
+        const double size = static_cast<double>(int64_t(1) << level);
+
+        // where the ray leaves this node's xz footprint
+        double tx = inf, tz = inf;
+        if (dx > 0.0) tx = ((nx + 1) * size - ox) / dx;
+        else if (dx < 0.0) tx = (nx * size - ox) / dx;
+        if (dz > 0.0) tz = ((nz + 1) * size - oz) / dz;
+        else if (dz < 0.0) tz = (nz * size - oz) / dz;
+        const double tExit = std::min(tx, tz);
+        const double tEnd = std::min(tExit, tMax);
+
+        const double y0 = oy + dy * t;
+        const double y1 = oy + dy * tEnd;
+        const double yLow = std::min(y0, y1), yHigh = std::max(y0, y1);
+
+        HeightRange r = nodeRange(level, nx, nz);
+        if (r.IsEmpty() || yLow >= r.max || yHigh < 0.0) {
+            // ray passes over (or under) everything in this node: skip it whole
+            t = tExit + eps;
+            if (level < maxLevel) ++level;
+            continue;
+        }
+        if (level > 0) {
+            --level;
+            continue;
+        }
+
+        // single column: walk its blocks in ray order, clipped to [0, h)
+        const int h = r.max;
+        const Chunk* chunk = chunks.at(GridKey(bx >> chunkShift, bz >> chunkShift));
+        const int step = dy < 0.0 ? -1 : 1;
+        int by = static_cast<int>(std::floor(y0));
+        const int byEnd = std::clamp(static_cast<int>(std::floor(y1)), 0, h - 1);
+        if (step < 0 && by > h - 1) by = h - 1; // entering through the top face
+        if (step > 0 && by < 0) by = 0;         // entering through the bottom face
+        for (; by >= 0 && by < h && (step > 0 ? by <= byEnd : by >= byEnd); by += step) {
+            if (!chunk->IsSolidAt(bx, by, bz)) continue;
+            double tHit = t;
+            if (by != static_cast<int>(std::floor(y0)))
+                tHit = ((step < 0 ? by + 1 : by) - oy) / dy; // crossed into this block vertically
+            hit.block = glm::ivec3(bx, by, bz);
+            hit.distance = static_cast<float>(tHit);
+            return true;
+        }
+
+        // only air along this column: carry on past it
+        t = tExit + eps;
+        if (level < maxLevel) ++level;
+    }
+    return false;
+}
@@ -0,0 +1,107 @@
+// HeightPyramid.hpp
+// Min/max mip pyramids over column heights, for queries that would otherwise
+// walk every column.
+//
+//  - HeightPyramid: built from one chunk's `heights`. Level 0 is the columns
+//    themselves, each level above halves the resolution and stores the min and
+//    max height of the 2x2 nodes below it. Non power-of-two sizes are padded
+//    with empty nodes.
+//  - TerrainQuadtree: stitches the per-chunk pyramids into one world-level tree
+//    (chunk roots, then 2x2 chunk blocks, ...). Supports region min/max in
+//    O(log n) nodes and ray marching that skips whole nodes the ray passes over.
+//
+// Heights follow Chunk's convention: h is one above the column's topmost solid
+// block, so nothing at y >= h is solid. Below h the column may hold air (caves,
+// overhangs), so the pyramids are only used to skip space; ray hits are
+// confirmed block by block against the chunk's voxels. Columns of unloaded
+// chunks count as empty.
+
+#pragma once
+#include <glm/glm.hpp>
+#include <climits>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "GridCoords.hpp"
+
+class Chunk;
+
+struct HeightRange {
+    int min = INT_MAX;
+    int max = INT_MIN;
+
+    bool IsEmpty() const { return max < min; }
+    void Merge(const HeightRange& o) {
+        if (o.min < min) min = o.min;
+        if (o.max > max) max = o.max;
+    }
+};
+
+class HeightPyramid {
+public:
+    // heights is indexed x + z * sizeX (same layout as Chunk::heights).
+    void Build(const std::vector<int>& heights, int sizeX, int sizeZ);
+
+    int Levels() const { return static_cast<int>(levels.size()); }
+    int Size() const { return size; } // padded side length (power of two)
+
+    // Node (nx, nz) at `level`; covers (1 << level)^2 columns. Out of range -> empty.
+    HeightRange Node(int level, int nx, int nz) const;
+    HeightRange Root() const { return Node(Levels() - 1, 0, 0); }
+
+    // Min/max over the inclusive local rect [x0,x1] x [z0,z1] (clipped).
+    HeightRange Query(int x0, int z0, int x1, int z1) const;
+
+    size_t ByteSize() const;
+
+private:
+    int size = 0;
+    std::vector<std::vector<HeightRange>> levels; // levels[0] = columns
+
+    void queryNode(int level, int nx, int nz, int x0, int z0, int x1, int z1, HeightRange& acc) const;
+};
+
+struct RayHit {
+    glm::ivec3 block;  // solid block that was hit
+    float distance;    // along the (normalized) ray direction
+};
+
+class TerrainQuadtree {
+public:
+    // chunkSize must be a power of two and match the square chunks inserted.
+    // worldLevels: how many 2x2 levels to build above the chunk roots.
+    explicit TerrainQuadtree(int chunkSize = 32, int worldLevels = 5);
+
+    // Registers a chunk (its height pyramid and voxels) at grid (cx, cz). The
+    // chunk must stay alive until Remove(); call Insert again after editing it.
+    void Insert(int cx, int cz, const Chunk* chunk);
+    void Remove(int cx, int cz);
+
+    // Min/max height over the inclusive world-column rect. Empty if nothing loaded.
+    HeightRange Query(int x0, int z0, int x1, int z1) const;
+
+    // Y of the highest solid block in the rect, or -1 if there is none.
+    int HighestBlockY(int x0, int z0, int x1, int z1) const;
+
+    // Hierarchical ray march: skips any node whose tallest column is below the
+    // ray's span across it, then walks the blocks of each column it enters.
+    // dir must be normalized.
+    bool Raycast(const glm::vec3& origin, const glm::vec3& dir, float maxDistance, RayHit& hit) const;
+
+    // Same traversal pinned to single columns (per-cell DDA). Reference/baseline.
+    bool RaycastPerCell(const glm::vec3& origin, const glm::vec3& dir, float maxDistance, RayHit& hit) const;
+
+private:
+    int chunkShift;  // log2(chunkSize) == top pyramid level
+    int topLevel;    // chunkShift + worldLevels
+    // worldNodes[k]: nodes covering (2^k)^2 chunks, k = 0 being single chunks
+    std::vector<std::unordered_map<int64_t, HeightRange>> worldNodes;
+    std::unordered_map<int64_t, const Chunk*> chunks;
+
+    // node at global level g (covers (1 << g)^2 columns) with node coords (nx, nz)
+    HeightRange nodeRange(int g, int nx, int nz) const;
+    void refreshAncestors(int cx, int cz);
+    void queryNode(int g, int nx, int nz, int x0, int z0, int x1, int z1, HeightRange& acc) const;
+    bool march(const glm::vec3& origin, const glm::vec3& dir, float maxDistance, int maxLevel, RayHit& hit) const;
+};
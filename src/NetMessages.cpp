@@ -0,0 +1,225 @@
+// NetMessages.cpp
+// Varint/zigzag primitives, RLE and per-message encode/decode.
+
+#include "NetMessages.hpp"
+
+// -----------------------------
+// ByteWriter / ByteReader
+// -----------------------------
+void ByteWriter::VarU(uint64_t v) {
+    while (v >= 0x80) {
+        buf.push_back(static_cast<uint8_t>(v | 0x80));
+        v >>= 7;
+    }
+    buf.push_back(static_cast<uint8_t>(v));
+}
+
+bool ByteReader::U8(uint8_t& v) {
+    if (!good || p >= end) return good = false;
+    v = *p++;
+    return true;
+}
+
+bool ByteReader::VarU(uint64_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t b;
+        if (!U8(b)) return false;
+        v |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return good = false; // over-long varint
+}
+
+bool ByteReader::VarS(int64_t& v) {
+    uint64_t u;
+    if (!VarU(u)) return false;
+    v = static_cast<int64_t>(u >> 1) ^ -static_cast<int64_t>(u & 1);
+    return true;
+}
+
+// -----------------------------
+// RLE
+// -----------------------------
+void RleEncode(const uint8_t* data, size_t size, ByteWriter& out) {
+    size_t i = 0;
+    while (i < size) {
+        size_t run = 1;
+        while (i + run < size && data[i + run] == data[i]) ++run;
+        out.VarU(run);
+        out.U8(data[i]);
+        i += run;
+    }
+}
+
+bool RleDecode(ByteReader& in, size_t expectedSize, std::vector<uint8_t>& out) {
+    out.clear();
+    while (out.size() < expectedSize) {
+        uint64_t run;
+        uint8_t value;
+        if (!in.VarU(run) || !in.U8(value)) return false;
+        if (run == 0 || out.size() + run > expectedSize) return false;
+        out.insert(out.end(), static_cast<size_t>(run), value);
+    }
+    return true;
+}
+
+// -----------------------------
+// Encoders
+// -----------------------------
+static ByteWriter begin(MessageType type) {
+    ByteWriter w;
+    w.U8(static_cast<uint8_t>(type));
+    return w;
+}
+
+std::vector<uint8_t> EncodeWelcome(uint32_t entityId) {
+    ByteWriter w = begin(MessageType::Welcome);
+    w.VarU(entityId);
+    return std::move(w.Data());
+}
+
+std::vector<uint8_t> EncodeChunkSnapshot(const ChunkSnapshotMsg& msg) {
+    ByteWriter w = begin(MessageType::ChunkSnapshot);
+    w.VarS(msg.cx);
+    w.VarS(msg.cz);
+    w.VarU(static_cast<uint64_t>(msg.sizeX));
+    w.VarU(static_cast<uint64_t>(msg.sizeZ));
+    w.VarU(static_cast<uint64_t>(msg.sizeY));
+    RleEncode(msg.voxels.data(), msg.voxels.size(), w);
+    RleEncode(msg.biomes.data(), msg.biomes.size(), w);
+    return std::move(w.Data());
+}
+
+std::vector<uint8_t> EncodeChunkUnload(int cx, int cz) {
+    ByteWriter w = begin(MessageType::ChunkUnload);
+    w.VarS(cx);
+    w.VarS(cz);
+    return std::move(w.Data());
+}
+
+std::vector<uint8_t> EncodeSectionDelta(const SectionDeltaMsg& msg) {
+    ByteWriter w = begin(MessageType::SectionDelta);
+    w.VarS(msg.cx);
+    w.VarS(msg.cz);
+    w.VarU(static_cast<uint64_t>(msg.section));
+    w.VarU(msg.changes.size());
+    for (const auto& c : msg.changes) {
+        w.VarU(c.index);
+        w.U8(c.value);
+    }
+    return std::move(w.Data());
+}
+
+std::vector<uint8_t> EncodeInput(const InputMsg& msg) {
+    ByteWriter w = begin(MessageType::Input);
+    w.VarU(msg.tick);
+    w.U8(static_cast<uint8_t>(msg.moveX));
+    w.U8(static_cast<uint8_t>(msg.moveZ));
+    w.U8(msg.jump ? 1 : 0);
+    return std::move(w.Data());
+}
+
+std::vector<uint8_t> EncodeSetBlock(const SetBlockMsg& msg) {
+    ByteWriter w = begin(MessageType::SetBlock);
+    w.VarS(msg.x);
+    w.VarS(msg.y);
+    w.VarS(msg.z);
+    w.U8(msg.value);
+    return std::move(w.Data());
+}
+
+void WriteEntityUpdate(ByteWriter& out, const EntityUpdate& update, const EntityState& previous) {
+    out.VarU(update.id);
+    out.U8(update.mask);
+    if (update.mask & EntityUpdate::kRemove) return;
+    // spawns carry absolute values, everything else is relative to `previous`
+    const EntityState base = (update.mask & EntityUpdate::kSpawn) ? EntityState{} : previous;
+    if (update.mask & EntityUpdate::kX) out.VarS(static_cast<int64_t>(update.state.x) - base.x);
+    if (update.mask & EntityUpdate::kY) out.VarS(static_cast<int64_t>(update.state.y) - base.y);
+    if (update.mask & EntityUpdate::kZ) out.VarS(static_cast<int64_t>(update.state.z) - base.z);
+}
+
+// -----------------------------
+// Decoders
+// -----------------------------
+bool ReadEntityUpdate(ByteReader& in, EntityUpdate& update, const EntityState& previous) {
+    uint64_t id;
+    if (!in.VarU(id) || !in.U8(update.mask)) return false;
+    update.id = static_cast<uint32_t>(id);
+    if (update.mask & EntityUpdate::kRemove) return true;
+
+    update.state = (update.mask & EntityUpdate::kSpawn) ? EntityState{} : previous;
+    int64_t d;
+    if (update.mask & EntityUpdate::kX) { if (!in.VarS(d)) return false; update.state.x += static_cast<int32_t>(d); }
+    if (update.mask & EntityUpdate::kY) { if (!in.VarS(d)) return false; update.state.y += static_cast<int32_t>(d); }
+    if (update.mask & EntityUpdate::kZ) { if (!in.VarS(d)) return false; update.state.z += static_cast<int32_t>(d); }
+    return true;
+}
+
+bool DecodeWelcome(ByteReader& in, uint32_t& entityId) {
+    uint64_t id;
+    if (!in.VarU(id)) return false;
+    entityId = static_cast<uint32_t>(id);
+    return true;
+}
+
+bool DecodeChunkSnapshot(ByteReader& in, ChunkSnapshotMsg& msg) {
+    int64_t cx, cz;
+    uint64_t sx, sz, sy;
+    if (!in.VarS(cx) || !in.VarS(cz) || !in.VarU(sx) || !in.VarU(sz) || !in.VarU(sy)) return false;
+    if (sx == 0 || sz == 0 || sy == 0) return false;
+    if (sx > kMaxSnapshotSizeXZ || sz > kMaxSnapshotSizeXZ || sy > kMaxSnapshotSizeY) return false;
+    msg.cx = static_cast<int>(cx);
+    msg.cz = static_cast<int>(cz);
+    msg.sizeX = static_cast<int>(sx);
+    msg.sizeZ = static_cast<int>(sz);
+    msg.sizeY = static_cast<int>(sy);
+    return RleDecode(in, static_cast<size_t>(sx * sz * sy), msg.voxels)
+        && RleDecode(in, static_cast<size_t>(sx * sz), msg.biomes);
+}
+
+bool DecodeChunkUnload(ByteReader& in, int& cx, int& cz) {
+    int64_t x, z;
+    if (!in.VarS(x) || !in.VarS(z)) return false;
+    cx = static_cast<int>(x);
+    cz = static_cast<int>(z);
+    return true;
+}
+
+bool DecodeSectionDelta(ByteReader& in, SectionDeltaMsg& msg) {
+    int64_t cx, cz;
+    uint64_t section, count;
+    if (!in.VarS(cx) || !in.VarS(cz) || !in.VarU(section) || !in.VarU(count)) return false;
+    msg.cx = static_cast<int>(cx);
+    msg.cz = static_cast<int>(cz);
+    msg.section = static_cast<int>(section);
+    msg.changes.clear();
+    for (uint64_t i = 0; i < count; ++i) {
+        uint64_t index;
+        uint8_t value;
+        if (!in.VarU(index) || !in.U8(value)) return false;
+        msg.changes.push_back(BlockChange{ static_cast<uint32_t>(index), value });
+    }
+    return true;
+}
+
+bool DecodeInput(ByteReader& in, InputMsg& msg) {
+    uint64_t tick;
+    uint8_t mx, mz, jump;
+    if (!in.VarU(tick) || !in.U8(mx) || !in.U8(mz) || !in.U8(jump)) return false;
+    msg.tick = static_cast<uint32_t>(tick);
+    msg.moveX = static_cast<int8_t>(mx);
+    msg.moveZ = static_cast<int8_t>(mz);
+    msg.jump = jump != 0;
+    return true;
+}
+
+bool DecodeSetBlock(ByteReader& in, SetBlockMsg& msg) {
+    int64_t x, y, z;
+    if (!in.VarS(x) || !in.VarS(y) || !in.VarS(z) || !in.U8(msg.value)) return false;
+    msg.x = static_cast<int>(x);
+    msg.y = static_cast<int>(y);
+    msg.z = static_cast<int>(z);
+    return true;
+}
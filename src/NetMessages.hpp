@@ -0,0 +1,151 @@
+// NetMessages.hpp
+// Wire format shared by WorldServer and WorldClient.
+//
+// Every message is one byte buffer starting with a MessageType byte. Integers
+// are LEB128 varints (signed ones zigzag-encoded first), so small deltas cost
+// one byte. Chunk snapshots run-length encode their voxel and biome arrays;
+// later block changes travel as per-section deltas and entity movement as
+// quantized per-field deltas against the last state sent to that client.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class MessageType : uint8_t {
+    // server -> client
+    Welcome = 1,        // assigned entity id
+    ChunkSnapshot = 2,  // full RLE-compressed chunk
+    ChunkUnload = 3,    // client may drop the chunk
+    SectionDelta = 4,   // block changes inside one 16-high section
+    EntityDelta = 5,    // changed entity fields since the last EntityDelta
+    // client -> server
+    Input = 10,         // movement intent for the client's entity
+    SetBlock = 11,      // request to change one block
+};
+
+// Blocks per vertical section for SectionDelta.
+static const int kSectionHeight = 16;
+
+// Largest chunk a snapshot may describe. Decoders reject bigger headers
+// before allocating anything, so a bad peer cannot request huge buffers.
+static const int kMaxSnapshotSizeXZ = 64;
+static const int kMaxSnapshotSizeY = 256;
+
+// Upper bound on any encoded message: a worst-case snapshot, where every RLE
+// run of the voxel and biome arrays is one long (2 bytes each), plus header.
+// Transports drop peers that announce a larger frame.
+static const size_t kMaxMessageBytes =
+    2 * static_cast<size_t>(kMaxSnapshotSizeXZ) * kMaxSnapshotSizeXZ * (kMaxSnapshotSizeY + 1) + 64;
+
+// Fixed-point scale for entity positions (1/32 block).
+static const float kPositionScale = 32.0f;
+
+// -----------------------------
+// Byte writer / reader
+// -----------------------------
+class ByteWriter {
+public:
+    void U8(uint8_t v) { buf.push_back(v); }
+    void VarU(uint64_t v);
+    void VarS(int64_t v) { VarU((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63)); }
+    void Bytes(const uint8_t* data, size_t n) { buf.insert(buf.end(), data, data + n); }
+
+    std::vector<uint8_t>& Data() { return buf; }
+
+private:
+    std::vector<uint8_t> buf;
+};
+
+class ByteReader {
+public:
+    ByteReader(const uint8_t* data, size_t size) : p(data), end(data + size) {}
+    explicit ByteReader(const std::vector<uint8_t>& v) : ByteReader(v.data(), v.size()) {}
+
+    // All reads return false (and leave ok() false) on truncated input.
+    bool U8(uint8_t& v);
+    bool VarU(uint64_t& v);
+    bool VarS(int64_t& v);
+
+    bool ok() const { return good; }
+    bool AtEnd() const { return p == end; }
+
+private:
+    const uint8_t* p;
+    const uint8_t* end;
+    bool good = true;
+};
+
+// -----------------------------
+// Run-length coding for snapshot arrays: (varint run, byte value) pairs.
+// -----------------------------
+// The decoder grows `out` run by run as input arrives; it never reserves
+// expectedSize up front, since that value comes from the untrusted header.
+void RleEncode(const uint8_t* data, size_t size, ByteWriter& out);
+bool RleDecode(ByteReader& in, size_t expectedSize, std::vector<uint8_t>& out);
+
+// -----------------------------
+// Decoded message payloads
+// -----------------------------
+struct ChunkSnapshotMsg {
+    int cx = 0, cz = 0;
+    int sizeX = 0, sizeZ = 0, sizeY = 0;
+    std::vector<uint8_t> voxels; // x + sizeX * (z + sizeZ * y)
+    std::vector<uint8_t> biomes; // x + z * sizeX
+};
+
+struct BlockChange {
+    uint32_t index; // within the section: x + sizeX * (z + sizeZ * (y % kSectionHeight))
+    uint8_t value;
+};
+
+struct SectionDeltaMsg {
+    int cx = 0, cz = 0;
+    int section = 0;
+    std::vector<BlockChange> changes;
+};
+
+// Quantized entity state (positions in 1/kPositionScale blocks).
+struct EntityState {
+    int32_t x = 0, y = 0, z = 0;
+};
+
+struct EntityUpdate {
+    enum : uint8_t { kX = 1, kY = 2, kZ = 4, kSpawn = 64, kRemove = 128 };
+    uint32_t id = 0;
+    uint8_t mask = 0;
+    EntityState state; // absolute after decoding
+};
+
+struct InputMsg {
+    uint32_t tick = 0;
+    int8_t moveX = 0, moveZ = 0; // -127..127 = -1..1
+    bool jump = false;
+};
+
+struct SetBlockMsg {
+    int x = 0, y = 0, z = 0;
+    uint8_t value = 0;
+};
+
+// -----------------------------
+// Encoders (return complete message buffers) / decoders (payload after type)
+// -----------------------------
+std::vector<uint8_t> EncodeWelcome(uint32_t entityId);
+std::vector<uint8_t> EncodeChunkSnapshot(const ChunkSnapshotMsg& msg);
+std::vector<uint8_t> EncodeChunkUnload(int cx, int cz);
+std::vector<uint8_t> EncodeSectionDelta(const SectionDeltaMsg& msg);
+std::vector<uint8_t> EncodeInput(const InputMsg& msg);
+std::vector<uint8_t> EncodeSetBlock(const SetBlockMsg& msg);
+
+// Entity deltas are encoded against `previous` (what the receiver already has).
+void WriteEntityUpdate(ByteWriter& out, const EntityUpdate& update, const EntityState& previous);
+bool ReadEntityUpdate(ByteReader& in, EntityUpdate& update, const EntityState& previous);
+
+bool DecodeWelcome(ByteReader& in, uint32_t& entityId);
+bool DecodeChunkSnapshot(ByteReader& in, ChunkSnapshotMsg& msg);
+bool DecodeChunkUnload(ByteReader& in, int& cx, int& cz);
+bool DecodeSectionDelta(ByteReader& in, SectionDeltaMsg& msg);
+bool DecodeInput(ByteReader& in, InputMsg& msg);
+bool DecodeSetBlock(ByteReader& in, SetBlockMsg& msg);
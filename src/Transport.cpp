@@ -0,0 +1,229 @@
+// Transport.cpp
+// Loopback queues and a small non-blocking TCP transport (Winsock / BSD sockets).
+
+#include "Transport.hpp"
+#include "NetMessages.hpp"
+
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+using socklen_t = int;
+static const intptr_t kInvalidSocket = static_cast<intptr_t>(INVALID_SOCKET);
+static void closeSocket(intptr_t s) { closesocket(static_cast<SOCKET>(s)); }
+static bool wouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+static void setNonBlocking(intptr_t s) {
+    u_long mode = 1;
+    ioctlsocket(static_cast<SOCKET>(s), FIONBIO, &mode);
+}
+static bool initSockets() {
+    static bool ok = [] {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+    return ok;
+}
+static const int kSendFlags = 0;
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+static const intptr_t kInvalidSocket = -1;
+static void closeSocket(intptr_t s) { close(static_cast<int>(s)); }
+static bool wouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINPROGRESS; }
+static void setNonBlocking(intptr_t s) {
+    int flags = fcntl(static_cast<int>(s), F_GETFL, 0);
+    fcntl(static_cast<int>(s), F_SETFL, flags | O_NONBLOCK);
+}
+static bool initSockets() { return true; }
+static const int kSendFlags = MSG_NOSIGNAL;
+#endif
+
+static sockaddr_in loopbackAddress(uint16_t port) {
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return addr;
+}
+
+static void setNoDelay(intptr_t s) {
+    int one = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&one), sizeof(one));
+}
+
+// -----------------------------
+// LoopbackTransport
+// -----------------------------
+std::pair<std::unique_ptr<LoopbackTransport>, std::unique_ptr<LoopbackTransport>> LoopbackTransport::CreatePair() {
+    auto a = std::make_shared<Queue>();
+    auto b = std::make_shared<Queue>();
+    std::unique_ptr<LoopbackTransport> server(new LoopbackTransport());
+    std::unique_ptr<LoopbackTransport> client(new LoopbackTransport());
+    server->inbox = a;
+    server->outbox = b;
+    client->inbox = b;
+    client->outbox = a;
+    return { std::move(server), std::move(client) };
+}
+
+void LoopbackTransport::Send(std::vector<uint8_t> message) {
+    bytesSent += message.size();
+    outbox->push_back(std::move(message));
+}
+
+bool LoopbackTransport::Receive(std::vector<uint8_t>& message) {
+    if (inbox->empty()) return false;
+    message = std::move(inbox->front());
+    inbox->pop_front();
+    bytesReceived += message.size();
+    return true;
+}
+
+// -----------------------------
+// TcpTransport
+// -----------------------------
+TcpTransport::TcpTransport(intptr_t socket) : sock(socket) {
+    setNonBlocking(sock);
+    setNoDelay(sock);
+}
+
+TcpTransport::~TcpTransport() {
+    if (sock != kInvalidSocket) closeSocket(sock);
+}
+
+std::unique_ptr<TcpTransport> TcpTransport::Connect(uint16_t port) {
+    if (!initSockets()) return nullptr;
+    intptr_t s = static_cast<intptr_t>(socket(AF_INET, SOCK_STREAM, IPPROTO_TCP));
+    if (s == kInvalidSocket) return nullptr;
+
+    sockaddr_in addr = loopbackAddress(port);
+    if (connect(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        closeSocket(s);
+        return nullptr;
+    }
+    return std::unique_ptr<TcpTransport>(new TcpTransport(s));
+}
+
+void TcpTransport::Send(std::vector<uint8_t> message) {
+    uint32_t n = static_cast<uint32_t>(message.size());
+    uint8_t header[4] = { static_cast<uint8_t>(n), static_cast<uint8_t>(n >> 8), static_cast<uint8_t>(n >> 16), static_cast<uint8_t>(n >> 24) };
+    sendBuf.insert(sendBuf.end(), header, header + 4);
+    sendBuf.insert(sendBuf.end(), message.begin(), message.end());
+    bytesSent += message.size() + 4;
+    Poll();
+}
+
+void TcpTransport::Poll() {
+    if (!open) return;
+
+    // flush as much of the send buffer as the socket takes
+    while (sendPos < sendBuf.size()) {
+        int n = static_cast<int>(send(sock, reinterpret_cast<const char*>(sendBuf.data() + sendPos), static_cast<int>(sendBuf.size() - sendPos), kSendFlags));
+        if (n > 0) {
+            sendPos += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && wouldBlock()) break;
+        open = false;
+        return;
+    }
+    if (sendPos == sendBuf.size()) {
+        sendBuf.clear();
+        sendPos = 0;
+    }
+
+    // drain whatever has arrived
+    char tmp[16384];
+    for (;;) {
+        int n = static_cast<int>(recv(sock, tmp, sizeof(tmp), 0));
+        if (n > 0) {
+            recvBuf.insert(recvBuf.end(), tmp, tmp + n);
+            continue;
+        }
+        if (n < 0 && wouldBlock()) break;
+        open = false; // orderly shutdown or error
+        break;
+    }
+}
+
+// Consumed frames are skipped with recvPos and only compacted away once they
+// make up half the buffer, so draining a backlog stays linear in its size.
+static const size_t kRecvCompactBytes = 64u << 10;
+
+bool TcpTransport::Receive(std::vector<uint8_t>& message) {
+    if (recvBuf.size() - recvPos < 4) Poll();
+    if (recvBuf.size() - recvPos < 4) return false;
+    const uint8_t* frame = recvBuf.data() + recvPos;
+    uint32_t n = static_cast<uint32_t>(frame[0]) | (static_cast<uint32_t>(frame[1]) << 8)
+        | (static_cast<uint32_t>(frame[2]) << 16) | (static_cast<uint32_t>(frame[3]) << 24);
+    if (n > kMaxMessageBytes) {
+        // a bad peer; do not wait (and buffer) for a frame this size
+        std::cerr << "TcpTransport: " << n << "-byte frame exceeds " << kMaxMessageBytes << ", closing\n";
+        closeConnection();
+        return false;
+    }
+    if (recvBuf.size() - recvPos < 4 + static_cast<size_t>(n)) return false;
+
+    message.assign(frame + 4, frame + 4 + n);
+    recvPos += 4 + static_cast<size_t>(n);
+    bytesReceived += n + 4;
+
+    if (recvPos == recvBuf.size()) {
+        recvBuf.clear();
+        recvPos = 0;
+    }
+    else if (recvPos >= kRecvCompactBytes && recvPos * 2 >= recvBuf.size()) {
+        recvBuf.erase(recvBuf.begin(), recvBuf.begin() + static_cast<std::ptrdiff_t>(recvPos));
+        recvPos = 0;
+    }
+    return true;
+}
+
+void TcpTransport::closeConnection() {
+    open = false;
+    if (sock != kInvalidSocket) closeSocket(sock);
+    sock = kInvalidSocket;
+    std::vector<uint8_t>().swap(recvBuf);
+    std::vector<uint8_t>().swap(sendBuf);
+    recvPos = sendPos = 0;
+}
+
+// -----------------------------
+// TcpListener
+// -----------------------------
+TcpListener::~TcpListener() {
+    if (sock != kInvalidSocket) closeSocket(sock);
+}
+
+std::unique_ptr<TcpListener> TcpListener::Listen(uint16_t port) {
+    if (!initSockets()) return nullptr;
+    intptr_t s = static_cast<intptr_t>(socket(AF_INET, SOCK_STREAM, IPPROTO_TCP));
+    if (s == kInvalidSocket) return nullptr;
+
+    int one = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&one), sizeof(one));
+
+    sockaddr_in addr = loopbackAddress(port);
+    if (bind(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(s, 64) != 0) {
+        closeSocket(s);
+        return nullptr;
+    }
+    setNonBlocking(s);
+    return std::unique_ptr<TcpListener>(new TcpListener(s));
+}
+
+std::unique_ptr<TcpTransport> TcpListener::Accept() {
+    sockaddr_in addr;
+    socklen_t len = sizeof(addr);
+    intptr_t c = static_cast<intptr_t>(accept(sock, reinterpret_cast<sockaddr*>(&addr), &len));
+    if (c == kInvalidSocket) return nullptr;
+    return std::unique_ptr<TcpTransport>(new TcpTransport(c));
+}
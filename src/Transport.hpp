@@ -0,0 +1,98 @@
+// Transport.hpp
+// Reliable, ordered message pipes between WorldServer and WorldClient.
+//
+//  - LoopbackTransport: in-process pair of queues (tests, load generation).
+//  - TcpTransport: local socket, frames each message with a 4-byte length.
+//    Non-blocking; Poll() moves bytes between the socket and the queues.
+//    A frame longer than kMaxMessageBytes closes the connection.
+//
+// Both count payload bytes in each direction so callers can report bandwidth.
+// TCP additionally counts the 4-byte frame headers.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+class Transport {
+public:
+    virtual ~Transport() = default;
+
+    virtual void Send(std::vector<uint8_t> message) = 0;
+    // Pops the next complete message; false if none is available yet.
+    virtual bool Receive(std::vector<uint8_t>& message) = 0;
+    // Pumps I/O (no-op for in-process transports).
+    virtual void Poll() {}
+    virtual bool IsOpen() const { return true; }
+
+    uint64_t BytesSent() const { return bytesSent; }
+    uint64_t BytesReceived() const { return bytesReceived; }
+
+protected:
+    uint64_t bytesSent = 0;
+    uint64_t bytesReceived = 0;
+};
+
+// -----------------------------
+// In-process transport
+// -----------------------------
+class LoopbackTransport : public Transport {
+public:
+    // Creates two connected endpoints (first = server side, second = client side).
+    static std::pair<std::unique_ptr<LoopbackTransport>, std::unique_ptr<LoopbackTransport>> CreatePair();
+
+    void Send(std::vector<uint8_t> message) override;
+    bool Receive(std::vector<uint8_t>& message) override;
+
+private:
+    using Queue = std::deque<std::vector<uint8_t>>;
+    std::shared_ptr<Queue> inbox;
+    std::shared_ptr<Queue> outbox;
+};
+
+// -----------------------------
+// Local TCP transport
+// -----------------------------
+class TcpTransport : public Transport {
+public:
+    ~TcpTransport() override;
+
+    // Connects to 127.0.0.1:port. Returns nullptr on failure.
+    static std::unique_ptr<TcpTransport> Connect(uint16_t port);
+
+    void Send(std::vector<uint8_t> message) override;
+    bool Receive(std::vector<uint8_t>& message) override;
+    void Poll() override;
+    bool IsOpen() const override { return open; }
+
+private:
+    friend class TcpListener;
+    explicit TcpTransport(intptr_t socket);
+
+    intptr_t sock;
+    bool open = true;
+    std::vector<uint8_t> sendBuf;
+    size_t sendPos = 0;
+    std::vector<uint8_t> recvBuf;
+    size_t recvPos = 0; // start of the first unread frame in recvBuf
+
+    void closeConnection();
+};
+
+class TcpListener {
+public:
+    ~TcpListener();
+
+    // Listens on 127.0.0.1:port. Returns nullptr on failure.
+    static std::unique_ptr<TcpListener> Listen(uint16_t port);
+
+    // Accepts one pending connection, or returns nullptr if none is waiting.
+    std::unique_ptr<TcpTransport> Accept();
+
+private:
+    explicit TcpListener(intptr_t socket) : sock(socket) {}
+    intptr_t sock;
+};
@@ -0,0 +1,149 @@
+// UploadPipeline.cpp
+// GL side of the staged upload path. Copies CPU meshes into the staging ring,
+// then asks each ChunkMesh to glCopyBufferSubData from the ring into its own VBOs.
+
+#include "UploadPipeline.hpp"
+#include "ChunkMesh.hpp"
+
+#include <glad/glad.h>
+
+#include <cstring>
+#include <iostream>
+
+static const size_t kStagingAlignment = 16;
+
+// -----------------------------
+// Construction / Destruction
+// -----------------------------
+UploadPipeline::UploadPipeline(size_t ringBytes, size_t frameBudgetBytes)
+    : ring(ringBytes), frameBudget(frameBudgetBytes) {
+    glGenBuffers(1, &ringBuffer);
+    glBindBuffer(GL_COPY_READ_BUFFER, ringBuffer);
+
+    if (GLAD_GL_VERSION_4_4 && glBufferStorage) {
+        // persistent + coherent: write once through the pointer, no map/unmap per copy
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_COPY_READ_BUFFER, static_cast<GLsizeiptr>(ringBytes), nullptr, flags);
+        mapped = glMapBufferRange(GL_COPY_READ_BUFFER, 0, static_cast<GLsizeiptr>(ringBytes), flags);
+        if (!mapped) std::cerr << "UploadPipeline: persistent map failed, falling back to per-copy mapping\n";
+    }
+    if (!mapped)
+        glBufferData(GL_COPY_READ_BUFFER, static_cast<GLsizeiptr>(ringBytes), nullptr, GL_STREAM_DRAW);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+}
+
+UploadPipeline::~UploadPipeline() {
+    for (auto& f : fences) glDeleteSync(static_cast<GLsync>(f.sync));
+    fences.clear();
+
+    if (ringBuffer) {
+        if (mapped) {
+            glBindBuffer(GL_COPY_READ_BUFFER, ringBuffer);
+            glUnmapBuffer(GL_COPY_READ_BUFFER);
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        }
+        glDeleteBuffers(1, &ringBuffer);
+    }
+
+    // meshes still queued must not call back into a dead pipeline
+    for (auto& entry : meshes) entry.second->uploader = nullptr;
+}
+
+// -----------------------------
+// Queue management
+// -----------------------------
+void UploadPipeline::Enqueue(ChunkMesh* mesh) {
+    uint64_t id = reinterpret_cast<uintptr_t>(mesh);
+    meshes[id] = mesh;
+    mesh->uploader = this;
+    size_t bytes = mesh->meshByteSize() + mesh->outlineByteSize();
+    scheduler.Enqueue(id, bytes, 0.0f, frameIndex);
+}
+
+void UploadPipeline::Cancel(ChunkMesh* mesh) {
+    uint64_t id = reinterpret_cast<uintptr_t>(mesh);
+    scheduler.Remove(id);
+    meshes.erase(id);
+    mesh->uploader = nullptr;
+}
+
+// -----------------------------
+// Per-frame update
+// -----------------------------
+void UploadPipeline::retireFences() {
+    while (!fences.empty()) {
+        GLsync sync = static_cast<GLsync>(fences.front().sync);
+        GLenum status = glClientWaitSync(sync, 0, 0); // poll, never block
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) break;
+        ring.Retire(fences.front().id);
+        glDeleteSync(sync);
+        fences.pop_front();
+    }
+}
+
+bool UploadPipeline::stage(ChunkMesh* mesh) {
+    const size_t meshBytes = mesh->meshByteSize();
+    const size_t outlineBytes = mesh->outlineByteSize();
+    const size_t total = meshBytes + outlineBytes;
+
+    if (total == 0 || total > ring.Capacity()) {
+        // nothing to stage, or too large for the ring: use the direct path
+        mesh->uploadMesh();
+        return true;
+    }
+
+    size_t offset = 0;
+    if (!ring.Allocate(total, kStagingAlignment, offset)) return false; // ring full this frame
+
+    if (mapped) {
+        char* dst = static_cast<char*>(mapped) + offset;
+        std::memcpy(dst, mesh->meshDataPtr(), meshBytes);
+        if (outlineBytes) std::memcpy(dst + meshBytes, mesh->outlineMeshData.data(), outlineBytes);
+    }
+    else {
+        // Unsynchronized is safe: the fence ring guarantees the GPU is done with this range.
+        glBindBuffer(GL_COPY_READ_BUFFER, ringBuffer);
+        void* dst = glMapBufferRange(GL_COPY_READ_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(total),
+            GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        if (!dst) {
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            mesh->uploadMesh();
+            return true;
+        }
+        std::memcpy(dst, mesh->meshDataPtr(), meshBytes);
+        if (outlineBytes) std::memcpy(static_cast<char*>(dst) + meshBytes, mesh->outlineMeshData.data(), outlineBytes);
+        glUnmapBuffer(GL_COPY_READ_BUFFER);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    }
+
+    mesh->commitUpload(ringBuffer, offset, offset + meshBytes);
+    return true;
+}
+
+void UploadPipeline::Update(const glm::vec3& cameraPos) {
+    ++frameIndex;
+    retireFences();
+
+    if (scheduler.PendingCount() == 0) return;
+
+    for (auto& entry : meshes)
+        scheduler.UpdateDistance(entry.first, glm::distance(cameraPos, entry.second->GetChunk().GetCenter()));
+
+    bool staged = false;
+    for (uint64_t id : scheduler.Select(frameBudget, frameIndex)) {
+        ChunkMesh* mesh = meshes[id];
+        if (!stage(mesh)) break; // keep it queued; retry once fences retire
+        staged = true;
+        scheduler.Remove(id);
+        meshes.erase(id);
+        mesh->uploader = nullptr;
+    }
+
+    if (staged) {
+        uint64_t id = nextFenceId++;
+        ring.Fence(id);
+        GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        fences.push_back(InFlightFence{ id, sync });
+    }
+}
@@ -0,0 +1,71 @@
+// UploadPipeline.hpp
+// Streams rebuilt chunk meshes to the GPU through a staging ring buffer instead
+// of calling glBufferData for every chunk in the frame it finished.
+//
+// Usage (once per frame, after GL is initialised):
+//   UploadPipeline uploader;              // before any ChunkMesh that uses it
+//   mesh.Build(&uploader);                // queues the upload
+//   uploader.Update(camera.Position);     // commits what fits in the budget
+//
+// The ring is persistently mapped when the context supports glBufferStorage
+// (GL 4.4); otherwise each copy maps its range unsynchronized. Either way, GLsync
+// fences keep a ring region from being overwritten while the GPU still reads it.
+
+#pragma once
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+
+#include "UploadQueue.hpp"
+
+class ChunkMesh;
+
+class UploadPipeline {
+public:
+    explicit UploadPipeline(size_t ringBytes = 16u << 20, size_t frameBudgetBytes = 2u << 20);
+    ~UploadPipeline();
+
+    UploadPipeline(const UploadPipeline&) = delete;
+    UploadPipeline& operator=(const UploadPipeline&) = delete;
+
+    // Queues the mesh's current CPU data. The data is read at commit time, so
+    // rebuilding again before then just refreshes the pending entry.
+    void Enqueue(ChunkMesh* mesh);
+
+    // Drops a pending upload (called by ChunkMesh's destructor).
+    void Cancel(ChunkMesh* mesh);
+
+    // Retires finished fences, then commits pending meshes in priority order
+    // until the per-frame byte budget is used, and fences this frame's copies.
+    void Update(const glm::vec3& cameraPos);
+
+    void SetFrameBudget(size_t bytes) { frameBudget = bytes; }
+    size_t GetFrameBudget() const { return frameBudget; }
+    bool IsPersistentlyMapped() const { return mapped != nullptr; }
+    size_t PendingCount() const { return scheduler.PendingCount(); }
+    size_t PendingBytes() const { return scheduler.PendingBytes(); }
+    size_t RingBytes() const { return ring.Capacity(); }
+
+private:
+    struct InFlightFence {
+        uint64_t id;
+        void* sync; // GLsync (kept opaque so this header does not need glad)
+    };
+
+    StagingRing ring;
+    UploadScheduler scheduler;
+    size_t frameBudget;
+
+    unsigned int ringBuffer = 0;
+    void* mapped = nullptr; // non-null when persistently mapped
+
+    uint64_t frameIndex = 0;
+    uint64_t nextFenceId = 1;
+    std::deque<InFlightFence> fences;
+    std::unordered_map<uint64_t, ChunkMesh*> meshes;
+
+    void retireFences();
+    bool stage(ChunkMesh* mesh);
+};
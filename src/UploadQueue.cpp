@@ -0,0 +1,119 @@
+// UploadQueue.cpp
+// Implementation of StagingRing and UploadScheduler (no OpenGL here).
+
+#include "UploadQueue.hpp"
+
+#include <algorithm>
+
+// -----------------------------
+// StagingRing
+// -----------------------------
+StagingRing::StagingRing(size_t capacity_) : capacity(capacity_) {}
+
+bool StagingRing::Allocate(size_t bytes, size_t alignment, size_t& outOffset) {
+    if (bytes == 0 || bytes > capacity) return false;
+    if (alignment == 0) alignment = 1;
+
+    size_t offset = (head + alignment - 1) & ~(alignment - 1);
+    size_t consumed;
+    if (offset + bytes > capacity) {
+        // not enough room before the end: skip the tail and wrap to 0
+        offset = 0;
+        consumed = (capacity - head) + bytes;
+    }
+    else {
+        consumed = (offset - head) + bytes;
+    }
+
+    // Free space is the contiguous (circular) range starting at head.
+    if (used + consumed > capacity) return false;
+
+    head = (offset + bytes) % capacity;
+    used += consumed;
+    unfencedBytes += consumed;
+    outOffset = offset;
+    return true;
+}
+
+void StagingRing::Fence(uint64_t fenceId) {
+    if (unfencedBytes == 0) return;
+    segments.push_back(Segment{ fenceId, unfencedBytes });
+    unfencedBytes = 0;
+}
+
+void StagingRing::Retire(uint64_t fenceId) {
+    while (!segments.empty() && segments.front().fenceId <= fenceId) {
+        used -= segments.front().bytes;
+        segments.pop_front();
+    }
+    // fully drained: restart at 0 so the next allocations do not need to wrap
+    if (used == 0) head = 0;
+}
+
+// -----------------------------
+// UploadScheduler
+// -----------------------------
+UploadScheduler::UploadScheduler(float agingPerFrame_) : agingPerFrame(agingPerFrame_) {}
+
+void UploadScheduler::Enqueue(uint64_t id, size_t bytes, float distance, uint64_t frame) {
+    for (auto& p : pending) {
+        if (p.id == id) {
+            p.bytes = bytes;
+            p.distance = distance;
+            return;
+        }
+    }
+    pending.push_back(Pending{ id, bytes, distance, frame });
+}
+
+void UploadScheduler::UpdateDistance(uint64_t id, float distance) {
+    for (auto& p : pending) {
+        if (p.id == id) {
+            p.distance = distance;
+            return;
+        }
+    }
+}
+
+bool UploadScheduler::Remove(uint64_t id) {
+    auto it = std::find_if(pending.begin(), pending.end(), [id](const Pending& p) { return p.id == id; });
+    if (it == pending.end()) return false;
+    pending.erase(it);
+    return true;
+}
+
+std::vector<uint64_t> UploadScheduler::Select(size_t byteBudget, uint64_t frame) const {
+    // score = distance minus an aging bonus; lower is better, ties go to the oldest
+    std::vector<const Pending*> order;
+    order.reserve(pending.size());
+    for (const auto& p : pending) order.push_back(&p);
+
+    auto score = [&](const Pending* p) {
+        float age = static_cast<float>(frame >= p->enqueuedFrame ? frame - p->enqueuedFrame : 0);
+        return p->distance - age * agingPerFrame;
+    };
+    std::stable_sort(order.begin(), order.end(), [&](const Pending* a, const Pending* b) {
+        float sa = score(a), sb = score(b);
+        if (sa != sb) return sa < sb;
+        return a->enqueuedFrame < b->enqueuedFrame;
+    });
+
+    std::vector<uint64_t> selected;
+    size_t total = 0;
+    for (const Pending* p : order) {
+        if (!selected.empty() && total + p->bytes > byteBudget) break;
+        selected.push_back(p->id);
+        total += p->bytes;
+    }
+    return selected;
+}
+
+bool UploadScheduler::Contains(uint64_t id) const {
+    return std::any_of(pending.begin(), pending.end(), [id](const Pending& p) { return p.id == id; });
+}
+
+size_t UploadScheduler::PendingBytes() const {
+    size_t total = 0;
+    for (const auto& p : pending) total += p.bytes;
+    return total;
+}
@@ -0,0 +1,90 @@
+// UploadQueue.hpp
+// GPU-free bookkeeping for streaming mesh uploads:
+//  - StagingRing: sub-allocates a fixed-size ring of staging memory. Each frame's
+//    allocations are tagged with a fence id; space is only reused once that fence
+//    has been retired (i.e. the GPU finished copying out of it).
+//  - UploadScheduler: holds meshes waiting for upload and picks which ones to
+//    commit this frame under a byte budget (oldest-nearest first).
+//
+// Nothing here touches OpenGL, so wraparound and scheduling can be exercised
+// without a context. UploadPipeline wires both to real buffers and GLsync fences.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+class StagingRing {
+public:
+    explicit StagingRing(size_t capacity);
+
+    // Reserves `bytes` contiguous bytes aligned to `alignment` (power of two).
+    // On success writes the start offset to outOffset and returns true.
+    // Returns false if the ring has no room until older fences are retired.
+    // If the request does not fit before the end of the ring, the tail is skipped
+    // (and counted as used) and the allocation wraps to offset 0.
+    bool Allocate(size_t bytes, size_t alignment, size_t& outOffset);
+
+    // Guards every allocation made since the previous Fence() call with fenceId.
+    // Fence ids must be increasing. Does nothing if nothing was allocated.
+    void Fence(uint64_t fenceId);
+
+    // Releases all regions guarded by fences <= fenceId.
+    void Retire(uint64_t fenceId);
+
+    size_t Capacity() const { return capacity; }
+    size_t Used() const { return used; }
+    size_t Head() const { return head; }
+    size_t InFlightFences() const { return segments.size(); }
+
+private:
+    struct Segment {
+        uint64_t fenceId;
+        size_t bytes; // includes alignment padding and skipped tail
+    };
+
+    size_t capacity;
+    size_t head = 0;         // next write position
+    size_t used = 0;         // bytes between tail and head (in flight + unfenced)
+    size_t unfencedBytes = 0;
+    std::deque<Segment> segments;
+};
+
+class UploadScheduler {
+public:
+    // agingPerFrame: how many distance units a waiting upload "moves closer" per
+    // frame it has been queued. Keeps far chunks from starving behind near ones.
+    explicit UploadScheduler(float agingPerFrame = 4.0f);
+
+    // Adds (or refreshes) a pending upload. Re-enqueuing an id that is already
+    // pending updates its size and distance but keeps its original age.
+    void Enqueue(uint64_t id, size_t bytes, float distance, uint64_t frame);
+
+    // Updates the distance used for priority. No-op for unknown ids.
+    void UpdateDistance(uint64_t id, float distance);
+
+    // Removes a pending upload (committed or cancelled). Returns false if absent.
+    bool Remove(uint64_t id);
+
+    // Returns pending ids in priority order whose cumulative size fits in
+    // byteBudget. The first candidate is always returned even if it alone
+    // exceeds the budget, so oversized meshes still make progress.
+    // Does not remove anything; call Remove() for each id actually committed.
+    std::vector<uint64_t> Select(size_t byteBudget, uint64_t frame) const;
+
+    bool Contains(uint64_t id) const;
+    size_t PendingCount() const { return pending.size(); }
+    size_t PendingBytes() const;
+
+private:
+    struct Pending {
+        uint64_t id;
+        size_t bytes;
+        float distance;
+        uint64_t enqueuedFrame;
+    };
+
+    float agingPerFrame;
+    std::vector<Pending> pending;
+};
@@ -0,0 +1,123 @@
+// WorldClient.cpp
+// Applies snapshots, section deltas and entity deltas from the server.
+
+#include "WorldClient.hpp"
+
+WorldClient::WorldClient(std::unique_ptr<Transport> transport_) : transport(std::move(transport_)) {}
+
+// -----------------------------
+// Outgoing
+// -----------------------------
+void WorldClient::SendInput(const InputMsg& input) {
+    transport->Send(EncodeInput(input));
+}
+
+void WorldClient::SendSetBlock(const SetBlockMsg& set) {
+    transport->Send(EncodeSetBlock(set));
+}
+
+// -----------------------------
+// Incoming
+// -----------------------------
+bool WorldClient::Update() {
+    transport->Poll();
+    std::vector<uint8_t> msg;
+    while (transport->Receive(msg)) {
+        if (msg.empty() || !handle(msg)) return false;
+        bytesByType[msg[0] & 15] += msg.size();
+    }
+    return transport->IsOpen();
+}
+
+bool WorldClient::handle(const std::vector<uint8_t>& msg) {
+    ByteReader in(msg.data() + 1, msg.size() - 1);
+    switch (static_cast<MessageType>(msg[0])) {
+    case MessageType::Welcome:
+        return DecodeWelcome(in, entityId);
+
+    case MessageType::ChunkSnapshot: {
+        ChunkSnapshotMsg snap;
+        if (!DecodeChunkSnapshot(in, snap)) return false;
+        // world coords map to chunks on one fixed grid, so every snapshot
+        // must have the footprint of the first
+        if (gridSizeX == 0) {
+            gridSizeX = snap.sizeX;
+            gridSizeZ = snap.sizeZ;
+        }
+        else if (snap.sizeX != gridSizeX || snap.sizeZ != gridSizeZ) {
+            return false;
+        }
+        ClientChunk& c = chunks[GridKey(snap.cx, snap.cz)];
+        c.sizeX = snap.sizeX;
+        c.sizeZ = snap.sizeZ;
+        c.sizeY = snap.sizeY;
+        c.voxels = std::move(snap.voxels);
+        c.biomes = std::move(snap.biomes);
+        return true;
+    }
+
+    case MessageType::ChunkUnload: {
+        int cx, cz;
+        if (!DecodeChunkUnload(in, cx, cz)) return false;
+        chunks.erase(GridKey(cx, cz));
+        return true;
+    }
+
+    case MessageType::SectionDelta: {
+        SectionDeltaMsg delta;
+        if (!DecodeSectionDelta(in, delta)) return false;
+        auto it = chunks.find(GridKey(delta.cx, delta.cz));
+        if (it == chunks.end()) return true; // already unloaded locally
+        ClientChunk& c = it->second;
+        const size_t sectionBase = static_cast<size_t>(delta.section) * kSectionHeight * c.sizeX * c.sizeZ;
+        for (const auto& change : delta.changes) {
+            size_t idx = sectionBase + change.index;
+            if (idx >= c.voxels.size()) return false;
+            c.voxels[idx] = change.value;
+        }
+        return true;
+    }
+
+    case MessageType::EntityDelta: {
+        uint64_t tick, count;
+        if (!in.VarU(tick) || !in.VarU(count)) return false;
+        for (uint64_t i = 0; i < count; ++i) {
+            // peek the id to find the previous state the delta is relative to
+            ByteReader peek = in;
+            uint64_t id;
+            if (!peek.VarU(id)) return false;
+            auto known = entities.find(static_cast<uint32_t>(id));
+            EntityState previous = known != entities.end() ? known->second : EntityState{};
+
+            EntityUpdate u;
+            if (!ReadEntityUpdate(in, u, previous)) return false;
+            if (u.mask & EntityUpdate::kRemove) entities.erase(u.id);
+            else entities[u.id] = u.state;
+        }
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+// -----------------------------
+// Queries
+// -----------------------------
+glm::vec3 WorldClient::GetEntityPosition(uint32_t id) const {
+    auto it = entities.find(id);
+    if (it == entities.end()) return glm::vec3(0.0f);
+    return glm::vec3(it->second.x, it->second.y, it->second.z) / kPositionScale;
+}
+
+bool WorldClient::IsSolidAt(int wx, int wy, int wz) const {
+    if (gridSizeX == 0 || wy < 0) return false;
+    int cx = FloorDiv(wx, gridSizeX), cz = FloorDiv(wz, gridSizeZ);
+    auto it = chunks.find(GridKey(cx, cz));
+    if (it == chunks.end()) return false;
+    const ClientChunk& c = it->second;
+    int lx = wx - cx * gridSizeX, lz = wz - cz * gridSizeZ;
+    if (wy >= c.sizeY) return false;
+    return c.voxels[static_cast<size_t>(lx) + static_cast<size_t>(c.sizeX) * (static_cast<size_t>(lz) + static_cast<size_t>(c.sizeZ) * wy)] != 0;
+}
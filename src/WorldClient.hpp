@@ -0,0 +1,58 @@
+// WorldClient.hpp
+// Receiving end of WorldServer's sync stream. Keeps a local copy of the
+// chunks in view and of every entity, and sends input / block edits.
+// Holds decoded voxel data only; building render meshes from it is up to the
+// caller.
+
+#pragma once
+#include <glm/glm.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "GridCoords.hpp"
+#include "NetMessages.hpp"
+#include "Transport.hpp"
+
+class WorldClient {
+public:
+    explicit WorldClient(std::unique_ptr<Transport> transport);
+
+    // Processes every message that has arrived. Returns false if the stream
+    // was malformed or the connection closed.
+    bool Update();
+
+    void SendInput(const InputMsg& input);
+    void SendSetBlock(const SetBlockMsg& set);
+
+    bool HasEntity() const { return entityId != 0 && entities.count(entityId) != 0; }
+    uint32_t GetEntityId() const { return entityId; }
+    glm::vec3 GetEntityPosition(uint32_t id) const;
+
+    bool IsSolidAt(int wx, int wy, int wz) const;
+    size_t ChunkCount() const { return chunks.size(); }
+    size_t EntityCount() const { return entities.size(); }
+
+    const Transport& GetTransport() const { return *transport; }
+    // Payload bytes received per MessageType (indexed by the type byte).
+    uint64_t BytesReceivedFor(MessageType type) const { return bytesByType[static_cast<uint8_t>(type) & 15]; }
+
+private:
+    struct ClientChunk {
+        int sizeX = 0, sizeZ = 0, sizeY = 0;
+        std::vector<uint8_t> voxels;
+        std::vector<uint8_t> biomes;
+    };
+
+    std::unique_ptr<Transport> transport;
+    uint32_t entityId = 0;
+    int gridSizeX = 0, gridSizeZ = 0; // chunk footprint, learned from the first snapshot
+    std::unordered_map<int64_t, ClientChunk> chunks;
+    std::unordered_map<uint32_t, EntityState> entities;
+    std::array<uint64_t, 16> bytesByType{};
+
+    bool handle(const std::vector<uint8_t>& msg);
+};
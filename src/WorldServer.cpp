@@ -0,0 +1,355 @@
+// WorldServer.cpp
+// Authoritative tick: input -> physics -> chunk/section/entity sync.
+
+#include "WorldServer.hpp"
+#include "Chunk.hpp"
+#include "Physics.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+static const float kMoveSpeed = 4.3f;   // blocks/s
+static const float kGravity = 20.0f;    // blocks/s^2
+static const float kJumpSpeed = 7.0f;
+static const float kPlayerRadius = 0.3f;
+static const float kPlayerHeight = 1.8f;
+
+// -----------------------------
+// Construction / clients
+// -----------------------------
+WorldServer::WorldServer() : WorldServer(Config()) {}
+
+WorldServer::WorldServer(const Config& config_)
+    : config(config_), biomeMap(config_.seed), density(config_.seed), terrain(config_.chunkSize) {}
+
+WorldServer::~WorldServer() = default;
+
+uint32_t WorldServer::AddClient(std::unique_ptr<Transport> transport) {
+    Entity e;
+    e.id = nextEntityId++;
+    e.pos = spawnPoint(e.id);
+    entities[e.id] = e;
+
+    Client c;
+    c.id = nextClientId++;
+    c.entityId = e.id;
+    c.transport = std::move(transport);
+    c.transport->Send(EncodeWelcome(e.id));
+    clients.push_back(std::move(c));
+    return clients.back().id;
+}
+
+uint64_t WorldServer::BytesSent() const {
+    uint64_t total = bytesSentClosed;
+    for (const auto& c : clients) total += c.transport->BytesSent();
+    return total;
+}
+
+// -----------------------------
+// World access
+// -----------------------------
+Chunk& WorldServer::chunkAt(int cx, int cz) {
+    const int64_t k = GridKey(cx, cz);
+    auto it = chunks.find(k);
+    if (it != chunks.end()) {
+        it->second.lastUsedTick = tick;
+        return *it->second.chunk;
+    }
+
+    const int size = config.chunkSize;
+    auto chunk = std::make_unique<Chunk>(cx * size, cz * size, size, size, &biomeMap, &density);
+
+    // regenerated after eviction: replay the edits made to it
+    auto edited = edits.find(k);
+    if (edited != edits.end()) {
+        for (const auto& e : edited->second) {
+            const int lx = static_cast<int>(e.first % size);
+            const int lz = static_cast<int>(e.first / size % size);
+            const int y = static_cast<int>(e.first / size / size);
+            chunk->SetBlockLocal(lx, y, lz, e.second != 0);
+        }
+    }
+    terrain.Insert(cx, cz, chunk.get());
+
+    LoadedChunk& loaded = chunks[k];
+    loaded.chunk = std::move(chunk);
+    loaded.lastUsedTick = tick;
+    return *loaded.chunk;
+}
+
+bool WorldServer::IsSolidAt(int wx, int wy, int wz) {
+    return chunkAt(FloorDiv(wx, config.chunkSize), FloorDiv(wz, config.chunkSize)).IsSolidAt(wx, wy, wz);
+}
+
+glm::vec3 WorldServer::spawnPoint(uint32_t entityId) {
+    // spread players over a grid near the origin, standing on the surface
+    int wx = static_cast<int>(entityId % 8) * 6 + 3;
+    int wz = static_cast<int>(entityId / 8) * 6 + 3;
+    chunkAt(FloorDiv(wx, config.chunkSize), FloorDiv(wz, config.chunkSize));
+    int top = terrain.HighestBlockY(wx, wz, wx, wz);
+    return glm::vec3(wx + 0.5f, static_cast<float>(top + 1), wz + 0.5f);
+}
+
+// -----------------------------
+// Tick
+// -----------------------------
+void WorldServer::Tick() {
+    auto t0 = std::chrono::steady_clock::now();
+    ++tick;
+
+    for (auto& c : clients) handleMessages(c);
+
+    const float dt = 1.0f / config.tickRate;
+    for (auto& entry : entities) simulate(entry.second, dt);
+
+    // drop closed connections (their entity disappears from everyone's view)
+    for (auto it = clients.begin(); it != clients.end();) {
+        if (!it->transport->IsOpen()) {
+            bytesSentClosed += it->transport->BytesSent();
+            entities.erase(it->entityId);
+            it = clients.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    for (auto& c : clients) {
+        syncChunks(c);
+        syncEntities(c);
+        c.transport->Poll();
+    }
+    dirtySections.clear();
+    evictChunks();
+
+    lastTickMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+void WorldServer::handleMessages(Client& client) {
+    client.transport->Poll();
+    Entity& e = entities[client.entityId];
+
+    std::vector<uint8_t> msg;
+    while (client.transport->Receive(msg)) {
+        if (msg.empty()) continue;
+        ByteReader in(msg.data() + 1, msg.size() - 1);
+        switch (static_cast<MessageType>(msg[0])) {
+        case MessageType::Input: {
+            InputMsg input;
+            if (!DecodeInput(in, input)) break;
+            e.moveX = std::clamp(input.moveX / 127.0f, -1.0f, 1.0f);
+            e.moveZ = std::clamp(input.moveZ / 127.0f, -1.0f, 1.0f);
+            e.jump = input.jump;
+            break;
+        }
+        case MessageType::SetBlock: {
+            SetBlockMsg set;
+            if (DecodeSetBlock(in, set)) applySetBlock(e, set);
+            break;
+        }
+        default:
+            break; // ignore unknown / server-only types
+        }
+    }
+}
+
+void WorldServer::applySetBlock(const Entity& entity, const SetBlockMsg& msg) {
+    // authoritative checks: within reach and inside the world's vertical range
+    glm::vec3 center(msg.x + 0.5f, msg.y + 0.5f, msg.z + 0.5f);
+    if (glm::distance(center, entity.pos) > config.editReach) return;
+
+    int cx = FloorDiv(msg.x, config.chunkSize), cz = FloorDiv(msg.z, config.chunkSize);
+    Chunk& chunk = chunkAt(cx, cz);
+    int lx = msg.x - cx * config.chunkSize;
+    int lz = msg.z - cz * config.chunkSize;
+    if (!chunk.SetBlockLocal(lx, msg.y, lz, msg.value != 0)) return;
+    terrain.Insert(cx, cz, &chunk); // refresh quadtree maxima
+    edits[GridKey(cx, cz)][static_cast<uint32_t>(lx + config.chunkSize * (lz + config.chunkSize * msg.y))] =
+        static_cast<uint8_t>(msg.value != 0);
+
+    int section = msg.y / kSectionHeight;
+    uint32_t index = static_cast<uint32_t>(lx + chunk.GetSizeX() * (lz + chunk.GetSizeZ() * (msg.y % kSectionHeight)));
+    dirtySections[SectionKey(cx, cz, section)].push_back(BlockChange{ index, static_cast<uint8_t>(msg.value != 0) });
+}
+
+void WorldServer::simulate(Entity& e, float dt) {
+    e.vel.x = e.moveX * kMoveSpeed;
+    e.vel.z = e.moveZ * kMoveSpeed;
+    if (e.jump && e.grounded) e.vel.y = kJumpSpeed;
+    e.vel.y -= kGravity * dt;
+    e.pos += e.vel * dt;
+
+    // candidate blocks around the player's AABB
+    std::vector<glm::ivec3> blocks;
+    int x0 = static_cast<int>(std::floor(e.pos.x - kPlayerRadius)) - 1;
+    int x1 = static_cast<int>(std::floor(e.pos.x + kPlayerRadius)) + 1;
+    int y0 = static_cast<int>(std::floor(e.pos.y)) - 1;
+    int y1 = static_cast<int>(std::floor(e.pos.y + kPlayerHeight)) + 1;
+    int z0 = static_cast<int>(std::floor(e.pos.z - kPlayerRadius)) - 1;
+    int z1 = static_cast<int>(std::floor(e.pos.z + kPlayerRadius)) + 1;
+    for (int y = y0; y <= y1; ++y)
+        for (int z = z0; z <= z1; ++z)
+            for (int x = x0; x <= x1; ++x)
+                if (IsSolidAt(x, y, z)) blocks.emplace_back(x, y, z);
+
+    ResolvePlayerCollisions(e.pos, e.vel, e.grounded, kPlayerRadius, kPlayerHeight, blocks);
+
+    if (e.pos.y < -16.0f) { // fell out of the world
+        e.pos = spawnPoint(e.id);
+        e.vel = glm::vec3(0.0f);
+    }
+}
+
+// -----------------------------
+// Sync
+// -----------------------------
+void WorldServer::syncChunks(Client& client) {
+    const Entity& e = entities[client.entityId];
+    const int ccx = FloorDiv(static_cast<int>(std::floor(e.pos.x)), config.chunkSize);
+    const int ccz = FloorDiv(static_cast<int>(std::floor(e.pos.z)), config.chunkSize);
+    const int r = config.viewRadius;
+
+    // chunks that left the view (with one chunk of hysteresis)
+    for (auto it = client.sentChunks.begin(); it != client.sentChunks.end();) {
+        int cx = GridKeyX(*it), cz = GridKeyZ(*it);
+        if (std::abs(cx - ccx) > r + 1 || std::abs(cz - ccz) > r + 1) {
+            client.transport->Send(EncodeChunkUnload(cx, cz));
+            it = client.sentChunks.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    // deltas first: chunks snapshotted below already contain this tick's edits
+    for (const auto& entry : dirtySections) {
+        int cx = std::get<0>(entry.first), cz = std::get<1>(entry.first);
+        if (!client.sentChunks.count(GridKey(cx, cz))) continue;
+        SectionDeltaMsg delta;
+        delta.cx = cx;
+        delta.cz = cz;
+        delta.section = std::get<2>(entry.first);
+        delta.changes = entry.second;
+        client.transport->Send(EncodeSectionDelta(delta));
+    }
+
+    // new chunks, nearest first
+    std::vector<std::pair<int, int64_t>> missing;
+    for (int cz = ccz - r; cz <= ccz + r; ++cz)
+        for (int cx = ccx - r; cx <= ccx + r; ++cx)
+            if (!client.sentChunks.count(GridKey(cx, cz)))
+                missing.emplace_back((cx - ccx) * (cx - ccx) + (cz - ccz) * (cz - ccz), GridKey(cx, cz));
+    std::sort(missing.begin(), missing.end());
+
+    int budget = config.snapshotsPerTick;
+    for (const auto& m : missing) {
+        if (budget-- <= 0) break;
+        int cx = GridKeyX(m.second), cz = GridKeyZ(m.second);
+        const Chunk& chunk = chunkAt(cx, cz);
+
+        ChunkSnapshotMsg snap;
+        snap.cx = cx;
+        snap.cz = cz;
+        snap.sizeX = chunk.GetSizeX();
+        snap.sizeZ = chunk.GetSizeZ();
+        snap.sizeY = chunk.GetMaxHeight();
+        snap.voxels = chunk.GetVoxels();
+        if (snap.voxels.empty()) {
+            // heightmap-only chunk: expand columns for the wire format
+            snap.voxels.assign(static_cast<size_t>(snap.sizeX) * snap.sizeZ * snap.sizeY, 0);
+            for (int z = 0; z < snap.sizeZ; ++z)
+                for (int x = 0; x < snap.sizeX; ++x)
+                    for (int y = 0; y < chunk.GetHeights()[static_cast<size_t>(x) + static_cast<size_t>(z) * snap.sizeX] && y < snap.sizeY; ++y)
+                        snap.voxels[static_cast<size_t>(x) + static_cast<size_t>(snap.sizeX) * (static_cast<size_t>(z) + static_cast<size_t>(snap.sizeZ) * y)] = 1;
+        }
+        snap.biomes.resize(static_cast<size_t>(snap.sizeX) * snap.sizeZ, static_cast<uint8_t>(Biome::Plains));
+        const std::vector<Biome>& biomes = chunk.GetBiomes();
+        for (size_t i = 0; i < biomes.size() && i < snap.biomes.size(); ++i)
+            snap.biomes[i] = static_cast<uint8_t>(biomes[i]);
+
+        client.transport->Send(EncodeChunkSnapshot(snap));
+        client.sentChunks.insert(m.second);
+    }
+}
+
+void WorldServer::syncEntities(Client& client) {
+    std::vector<std::pair<EntityUpdate, EntityState>> updates; // (update, previous)
+
+    for (const auto& entry : entities) {
+        const Entity& e = entry.second;
+        EntityState q;
+        q.x = static_cast<int32_t>(std::lround(e.pos.x * kPositionScale));
+        q.y = static_cast<int32_t>(std::lround(e.pos.y * kPositionScale));
+        q.z = static_cast<int32_t>(std::lround(e.pos.z * kPositionScale));
+
+        EntityUpdate u;
+        u.id = e.id;
+        u.state = q;
+        EntityState previous;
+        auto known = client.knownEntities.find(e.id);
+        if (known == client.knownEntities.end()) {
+            u.mask = EntityUpdate::kSpawn | EntityUpdate::kX | EntityUpdate::kY | EntityUpdate::kZ;
+        }
+        else {
+            previous = known->second;
+            if (q.x != previous.x) u.mask |= EntityUpdate::kX;
+            if (q.y != previous.y) u.mask |= EntityUpdate::kY;
+            if (q.z != previous.z) u.mask |= EntityUpdate::kZ;
+            if (u.mask == 0) continue; // unchanged: costs nothing
+        }
+        updates.emplace_back(u, previous);
+        client.knownEntities[e.id] = q;
+    }
+
+    for (auto it = client.knownEntities.begin(); it != client.knownEntities.end();) {
+        if (entities.count(it->first)) {
+            ++it;
+            continue;
+        }
+        EntityUpdate u;
+        u.id = it->first;
+        u.mask = EntityUpdate::kRemove;
+        updates.emplace_back(u, EntityState{});
+        it = client.knownEntities.erase(it);
+    }
+
+    if (updates.empty()) return;
+
+    ByteWriter w;
+    w.U8(static_cast<uint8_t>(MessageType::EntityDelta));
+    w.VarU(tick);
+    w.VarU(updates.size());
+    for (const auto& u : updates) WriteEntityUpdate(w, u.first, u.second);
+    client.transport->Send(std::move(w.Data()));
+}
+
+// -----------------------------
+// Chunk eviction
+// -----------------------------
+void WorldServer::evictChunks() {
+    // chunks inside any client's view window (same hysteresis as ChunkUnload)
+    const int r = config.viewRadius + 1;
+    for (const auto& client : clients) {
+        const Entity& e = entities[client.entityId];
+        const int ccx = FloorDiv(static_cast<int>(std::floor(e.pos.x)), config.chunkSize);
+        const int ccz = FloorDiv(static_cast<int>(std::floor(e.pos.z)), config.chunkSize);
+        for (int cz = ccz - r; cz <= ccz + r; ++cz) {
+            for (int cx = ccx - r; cx <= ccx + r; ++cx) {
+                auto it = chunks.find(GridKey(cx, cz));
+                if (it != chunks.end()) it->second.lastUsedTick = tick;
+            }
+        }
+    }
+
+    for (auto it = chunks.begin(); it != chunks.end();) {
+        if (tick - it->second.lastUsedTick > config.chunkKeepTicks) {
+            terrain.Remove(GridKeyX(it->first), GridKeyZ(it->first));
+            it = chunks.erase(it);
+            ++evictions;
+        }
+        else {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,129 @@
+// WorldServer.hpp
+// Headless, authoritative world: generates chunks, simulates one player
+// entity per client and keeps every client in sync. No OpenGL is touched.
+//
+// Per client the server sends, in order:
+//  - ChunkSnapshot once for each chunk that enters its view (RLE-compressed,
+//    nearest first, a few per tick to avoid bursts) and ChunkUnload when it
+//    leaves again;
+//  - SectionDelta for block edits in chunks the client already has;
+//  - one EntityDelta per tick carrying only the fields that changed since the
+//    last state that client was sent.
+// Transports are reliable and ordered, so deltas never need to be resent.
+//
+// Chunks are generated on demand and evicted once no client has had them in
+// view for chunkKeepTicks. Block edits are kept per chunk (a few bytes each)
+// and replayed when an evicted chunk is generated again.
+
+#pragma once
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "BiomeMap.hpp"
+#include "DensityTerrain.hpp"
+#include "GridCoords.hpp"
+#include "HeightPyramid.hpp"
+#include "NetMessages.hpp"
+#include "Transport.hpp"
+
+class Chunk;
+
+class WorldServer {
+public:
+    struct Config {
+        uint32_t seed = 123456;
+        int chunkSize = 32;
+        int viewRadius = 4;        // chunks around each client's entity
+        int snapshotsPerTick = 4;  // per client
+        float tickRate = 20.0f;    // simulation steps per second
+        float editReach = 8.0f;    // max distance for SetBlock requests
+        uint32_t chunkKeepTicks = 200; // unseen ticks before a chunk is evicted
+    };
+
+    WorldServer();
+    explicit WorldServer(const Config& config);
+    ~WorldServer();
+
+    WorldServer(const WorldServer&) = delete;
+    WorldServer& operator=(const WorldServer&) = delete;
+
+    // Takes ownership of a connection and spawns its entity. Returns client id.
+    uint32_t AddClient(std::unique_ptr<Transport> transport);
+
+    // One fixed step: read client messages, simulate, send updates.
+    // Closed connections are dropped here.
+    void Tick();
+
+    const Config& GetConfig() const { return config; }
+    size_t ClientCount() const { return clients.size(); }
+    size_t LoadedChunks() const { return chunks.size(); }
+    uint64_t EvictedChunks() const { return evictions; }
+    uint32_t CurrentTick() const { return tick; }
+    double LastTickMs() const { return lastTickMs; }
+    // Bytes sent to all clients so far (including disconnected ones).
+    uint64_t BytesSent() const;
+
+    // Solid test against authoritative data (generates the chunk if needed).
+    bool IsSolidAt(int wx, int wy, int wz);
+
+private:
+    struct Entity {
+        uint32_t id = 0;
+        glm::vec3 pos = glm::vec3(0.0f);
+        glm::vec3 vel = glm::vec3(0.0f);
+        bool grounded = false;
+        float moveX = 0.0f, moveZ = 0.0f;
+        bool jump = false;
+    };
+
+    struct Client {
+        uint32_t id = 0;
+        uint32_t entityId = 0;
+        std::unique_ptr<Transport> transport;
+        std::unordered_set<int64_t> sentChunks;
+        std::unordered_map<uint32_t, EntityState> knownEntities; // last state sent
+    };
+
+    struct LoadedChunk {
+        std::unique_ptr<Chunk> chunk;
+        uint32_t lastUsedTick = 0; // last tick a client had it in view (or it was touched)
+    };
+
+    // (cx, cz, section) -> changes since the last tick
+    using SectionKey = std::tuple<int, int, int>;
+
+    Config config;
+    BiomeMap biomeMap;
+    DensityTerrain density;
+    TerrainQuadtree terrain;
+
+    std::unordered_map<int64_t, LoadedChunk> chunks;
+    // chunk key -> (local block index -> value) for every edit ever applied
+    std::unordered_map<int64_t, std::unordered_map<uint32_t, uint8_t>> edits;
+    std::map<SectionKey, std::vector<BlockChange>> dirtySections;
+    std::vector<Client> clients;
+    std::unordered_map<uint32_t, Entity> entities;
+
+    uint32_t nextClientId = 1;
+    uint32_t nextEntityId = 1;
+    uint32_t tick = 0;
+    double lastTickMs = 0.0;
+    uint64_t bytesSentClosed = 0; // from clients that already disconnected
+    uint64_t evictions = 0;
+
+    Chunk& chunkAt(int cx, int cz);
+    glm::vec3 spawnPoint(uint32_t entityId);
+    void handleMessages(Client& client);
+    void applySetBlock(const Entity& entity, const SetBlockMsg& msg);
+    void simulate(Entity& e, float dt);
+    void syncChunks(Client& client);
+    void syncEntities(Client& client);
+    void evictChunks();
+};
@@ -0,0 +1,76 @@
+// biomebench_main.cpp
+// Per-chunk cost of the biome heightmap generator against the flat single-noise
+// generator it replaced. The biome path is timed three ways:
+//  - cold:  a fresh BiomeMap per chunk (every climate region is filled)
+//  - first: one BiomeMap, first pass over the grid (regions filled as reached,
+//           as when a player walks into new terrain)
+//  - warm:  second pass over the same grid (all regions cached)
+//
+// Usage: Minecraft_BiomeBench [--chunks N] [--seed S]
+//   N is the grid side; keep N <= 32 so the warm pass fits the region cache.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "BiomeMap.hpp"
+#include "Chunk.hpp"
+
+int main(int argc, char** argv) {
+    int gridChunks = 16;
+    uint32_t seed = 123456;
+    const int chunkSize = 32;
+
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&](int fallback) { return i + 1 < argc ? std::atoi(argv[++i]) : fallback; };
+        if (!std::strcmp(argv[i], "--chunks")) gridChunks = next(gridChunks);
+        else if (!std::strcmp(argv[i], "--seed")) seed = static_cast<uint32_t>(next(123456));
+        else {
+            std::fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return -1;
+        }
+    }
+
+    // Chunks are created once (flat) and regenerated in place, so allocation
+    // and construction are not part of any timing.
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    for (int cz = 0; cz < gridChunks; ++cz)
+        for (int cx = 0; cx < gridChunks; ++cx)
+            chunks.push_back(std::make_unique<Chunk>(cx * chunkSize, cz * chunkSize, chunkSize, chunkSize));
+    const double count = static_cast<double>(chunks.size());
+
+    using Clock = std::chrono::steady_clock;
+    auto usPerChunk = [&](Clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / count;
+    };
+
+    auto t0 = Clock::now();
+    for (auto& c : chunks) c->GenerateHeightmapWithPerlin();
+    double flatUs = usPerChunk(t0);
+
+    std::vector<std::unique_ptr<BiomeMap>> coldMaps;
+    for (size_t i = 0; i < chunks.size(); ++i) coldMaps.push_back(std::make_unique<BiomeMap>(seed));
+    t0 = Clock::now();
+    for (size_t i = 0; i < chunks.size(); ++i) chunks[i]->GenerateHeightmapWithBiomes(*coldMaps[i]);
+    double coldUs = usPerChunk(t0);
+
+    BiomeMap biomeMap(seed);
+    t0 = Clock::now();
+    for (auto& c : chunks) c->GenerateHeightmapWithBiomes(biomeMap);
+    double firstUs = usPerChunk(t0);
+
+    t0 = Clock::now();
+    for (auto& c : chunks) c->GenerateHeightmapWithBiomes(biomeMap);
+    double warmUs = usPerChunk(t0);
+
+    std::printf("%dx%d chunks of %dx%d columns | %zu climate regions cached\n",
+        gridChunks, gridChunks, chunkSize, chunkSize, biomeMap.CachedRegions());
+    std::printf("flat  %8.1f us/chunk\n", flatUs);
+    std::printf("biome %8.1f us/chunk cold (%.2fx flat)\n", coldUs, coldUs / flatUs);
+    std::printf("biome %8.1f us/chunk first pass (%.2fx flat)\n", firstUs, firstUs / flatUs);
+    std::printf("biome %8.1f us/chunk warm (%.2fx flat)\n", warmUs, warmUs / flatUs);
+    return 0;
+}
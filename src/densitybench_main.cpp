@@ -0,0 +1,128 @@
+// densitybench_main.cpp
+// Per-chunk cost and accuracy of DensityTerrain::Fill (noise on a coarse
+// lattice, trilinearly interpolated) against FillFullResolution (noise at
+// every voxel). Both run over the same biome heightmaps.
+//
+// Usage: Minecraft_DensityBench [--chunks N] [--seed S] [--min-speedup X]
+//   N is the grid side (N x N chunks of 32x32x64 voxels).
+// Exits non-zero if Fill samples the noise at fewer than kMinSampleRatio times
+// fewer points, or if the two agree on fewer than kMinAgreement of the voxels
+// that are solid in either. Both are deterministic. The measured speedup is
+// only printed unless --min-speedup asks for it to be checked too (wall-clock
+// timing is too noisy to gate ctest on).
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "BiomeMap.hpp"
+#include "Chunk.hpp"
+#include "DensityTerrain.hpp"
+
+static const double kMinSampleRatio = 20.0;
+static const double kMinAgreement = 0.88;
+static const int kRepeats = 3;
+
+int main(int argc, char** argv) {
+    int gridChunks = 8;
+    uint32_t seed = 123456;
+    double minSpeedup = 0.0; // 0 = report only
+    const int chunkSize = 32;
+
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&](int fallback) { return i + 1 < argc ? std::atoi(argv[++i]) : fallback; };
+        if (!std::strcmp(argv[i], "--chunks")) gridChunks = next(gridChunks);
+        else if (!std::strcmp(argv[i], "--seed")) seed = static_cast<uint32_t>(next(123456));
+        else if (!std::strcmp(argv[i], "--min-speedup") && i + 1 < argc) minSpeedup = std::atof(argv[++i]);
+        else {
+            std::fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return -1;
+        }
+    }
+
+    // Heightmap-only chunks supply the surfaces both passes carve.
+    BiomeMap biomeMap(seed);
+    DensityTerrain density(seed);
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    for (int cz = 0; cz < gridChunks; ++cz)
+        for (int cx = 0; cx < gridChunks; ++cx)
+            chunks.push_back(std::make_unique<Chunk>(cx * chunkSize, cz * chunkSize, chunkSize, chunkSize, &biomeMap));
+    const double count = static_cast<double>(chunks.size());
+
+    std::vector<std::vector<uint8_t>> coarse(chunks.size()), full(chunks.size());
+
+    using Clock = std::chrono::steady_clock;
+    auto usPerChunk = [&](Clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / count;
+    };
+
+    // Untimed pass so both outputs are allocated before either is timed; it
+    // also counts the noise samples each path takes.
+    size_t fillSamples = 0, fullSamples = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        const Chunk& c = *chunks[i];
+        fillSamples += density.Fill(c.GetOriginX(), c.GetOriginZ(), chunkSize, chunkSize, c.GetMaxHeight(), c.GetHeights(), coarse[i]);
+        fullSamples += density.FillFullResolution(c.GetOriginX(), c.GetOriginZ(), chunkSize, chunkSize, c.GetMaxHeight(), c.GetHeights(), full[i]);
+    }
+
+    // Best of kRepeats passes each, to keep scheduler hiccups out of the report.
+    double fillUs = 0.0, fullUs = 0.0;
+    for (int rep = 0; rep < kRepeats; ++rep) {
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            const Chunk& c = *chunks[i];
+            density.Fill(c.GetOriginX(), c.GetOriginZ(), chunkSize, chunkSize, c.GetMaxHeight(), c.GetHeights(), coarse[i]);
+        }
+        double us = usPerChunk(t0);
+        if (rep == 0 || us < fillUs) fillUs = us;
+
+        t0 = Clock::now();
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            const Chunk& c = *chunks[i];
+            density.FillFullResolution(c.GetOriginX(), c.GetOriginZ(), chunkSize, chunkSize, c.GetMaxHeight(), c.GetHeights(), full[i]);
+        }
+        us = usPerChunk(t0);
+        if (rep == 0 || us < fullUs) fullUs = us;
+    }
+
+    // Most voxels are trivially air above the terrain or solid deep below it,
+    // so agreement is measured over voxels solid in at least one output.
+    size_t voxels = 0, same = 0, solidEither = 0, solidBoth = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        for (size_t v = 0; v < coarse[i].size(); ++v) {
+            const bool a = coarse[i][v] != 0, b = full[i][v] != 0;
+            ++voxels;
+            if (a == b) ++same;
+            if (a || b) ++solidEither;
+            if (a && b) ++solidBoth;
+        }
+    }
+    const double speedup = fillUs > 0.0 ? fullUs / fillUs : 0.0;
+    const double sampleRatio = fillSamples ? static_cast<double>(fullSamples) / fillSamples : 0.0;
+    const double agreement = solidEither ? static_cast<double>(solidBoth) / solidEither : 1.0;
+
+    std::printf("%dx%d chunks of %dx%dx%d voxels\n", gridChunks, gridChunks, chunkSize, chunkSize, chunks[0]->GetMaxHeight());
+    std::printf("interpolated    %8.1f us/chunk | %8.0f samples/chunk\n", fillUs, fillSamples / count);
+    std::printf("full resolution %8.1f us/chunk | %8.0f samples/chunk\n", fullUs, fullSamples / count);
+    std::printf("speedup %.1fx | sample ratio %.1fx (min %.0fx)\n", speedup, sampleRatio, kMinSampleRatio);
+    std::printf("agreement %.1f%% of voxels solid in either (min %.0f%%) | %.1f%% of all voxels\n",
+        agreement * 100.0, kMinAgreement * 100.0, voxels ? 100.0 * same / voxels : 100.0);
+
+    bool ok = true;
+    if (sampleRatio < kMinSampleRatio) {
+        std::fprintf(stderr, "FAIL: sample ratio %.1fx below %.0fx\n", sampleRatio, kMinSampleRatio);
+        ok = false;
+    }
+    if (minSpeedup > 0.0 && speedup < minSpeedup) {
+        std::fprintf(stderr, "FAIL: speedup %.1fx below %.1fx\n", speedup, minSpeedup);
+        ok = false;
+    }
+    if (agreement < kMinAgreement) {
+        std::fprintf(stderr, "FAIL: agreement %.1f%% below %.0f%%\n", agreement * 100.0, kMinAgreement * 100.0);
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,187 @@
+// loadgen_main.cpp
+// Load generator for WorldServer: N simulated clients random-walk and
+// occasionally dig/place blocks; reports per-client bandwidth and server tick
+// time.
+//
+// Usage: Minecraft_LoadGen [--clients N] [--ticks T] [--edit-rate P]
+//                          [--tcp PORT | --connect PORT] [--seed S]
+//   (default)       server and clients in-process over LoopbackTransport
+//   --tcp PORT      in-process server, clients connect over 127.0.0.1:PORT
+//   --connect PORT  clients only, against a running Minecraft_Server
+//                   (ticks paced in real time; tick time is reported there)
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Transport.hpp"
+#include "WorldClient.hpp"
+#include "WorldServer.hpp"
+
+struct SimClient {
+    std::unique_ptr<WorldClient> client;
+    float heading = 0.0f;
+};
+
+static double percentile(std::vector<double> v, double p) {
+    if (v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    size_t i = static_cast<size_t>(p * (v.size() - 1) + 0.5);
+    return v[i];
+}
+
+int main(int argc, char** argv) {
+    int numClients = 16;
+    int ticks = 600;
+    double editRate = 0.05; // chance per client per tick to send a SetBlock
+    int tcpPort = 0, connectPort = 0;
+    WorldServer::Config config;
+
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&](int fallback) { return i + 1 < argc ? std::atoi(argv[++i]) : fallback; };
+        if (!std::strcmp(argv[i], "--clients")) numClients = next(numClients);
+        else if (!std::strcmp(argv[i], "--ticks")) ticks = next(ticks);
+        else if (!std::strcmp(argv[i], "--edit-rate") && i + 1 < argc) editRate = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--tcp")) tcpPort = next(25570);
+        else if (!std::strcmp(argv[i], "--connect")) connectPort = next(25570);
+        else if (!std::strcmp(argv[i], "--seed")) config.seed = static_cast<uint32_t>(next(123456));
+        else {
+            std::fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return -1;
+        }
+    }
+
+    // -----------------------------
+    // Set up server + connections
+    // -----------------------------
+    std::unique_ptr<WorldServer> server;
+    if (!connectPort) server = std::make_unique<WorldServer>(config);
+
+    std::vector<SimClient> sims(static_cast<size_t>(numClients));
+    if (tcpPort || connectPort) {
+        uint16_t port = static_cast<uint16_t>(tcpPort ? tcpPort : connectPort);
+        std::unique_ptr<TcpListener> listener;
+        if (tcpPort) {
+            listener = TcpListener::Listen(port);
+            if (!listener) {
+                std::fprintf(stderr, "failed to listen on 127.0.0.1:%u\n", port);
+                return -1;
+            }
+        }
+        for (auto& sim : sims) {
+            auto transport = TcpTransport::Connect(port);
+            if (!transport) {
+                std::fprintf(stderr, "failed to connect to 127.0.0.1:%u\n", port);
+                return -1;
+            }
+            sim.client = std::make_unique<WorldClient>(std::move(transport));
+            if (listener) {
+                std::unique_ptr<TcpTransport> accepted;
+                while (!(accepted = listener->Accept())) std::this_thread::yield();
+                server->AddClient(std::move(accepted));
+            }
+        }
+    }
+    else {
+        for (auto& sim : sims) {
+            auto pair = LoopbackTransport::CreatePair();
+            server->AddClient(std::move(pair.first));
+            sim.client = std::make_unique<WorldClient>(std::move(pair.second));
+        }
+    }
+
+    // -----------------------------
+    // Run
+    // -----------------------------
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> uni(0.0f, 1.0f);
+    std::vector<double> tickMs;
+    tickMs.reserve(static_cast<size_t>(ticks));
+    const auto tickLength = std::chrono::duration<double>(1.0 / config.tickRate);
+    auto nextTick = std::chrono::steady_clock::now();
+
+    for (int t = 0; t < ticks; ++t) {
+        for (auto& sim : sims) {
+            WorldClient& c = *sim.client;
+            if (!c.Update()) {
+                std::fprintf(stderr, "client stream error/closed at tick %d\n", t);
+                return -1;
+            }
+
+            // random walk with occasional jumps
+            sim.heading += (uni(rng) - 0.5f) * 0.6f;
+            InputMsg input;
+            input.tick = static_cast<uint32_t>(t);
+            input.moveX = static_cast<int8_t>(std::cos(sim.heading) * 127.0f);
+            input.moveZ = static_cast<int8_t>(std::sin(sim.heading) * 127.0f);
+            input.jump = uni(rng) < 0.05f;
+            c.SendInput(input);
+
+            // dig or place a block within reach
+            if (c.HasEntity() && uni(rng) < editRate) {
+                glm::vec3 p = c.GetEntityPosition(c.GetEntityId());
+                SetBlockMsg set;
+                set.x = static_cast<int>(std::floor(p.x)) + static_cast<int>(uni(rng) * 7.0f) - 3;
+                set.z = static_cast<int>(std::floor(p.z)) + static_cast<int>(uni(rng) * 7.0f) - 3;
+                set.y = static_cast<int>(std::floor(p.y)) - 1 + static_cast<int>(uni(rng) * 3.0f);
+                set.value = uni(rng) < 0.5f ? 0 : 1;
+                c.SendSetBlock(set);
+            }
+        }
+
+        if (server) {
+            server->Tick();
+            tickMs.push_back(server->LastTickMs());
+        }
+        else {
+            nextTick += std::chrono::duration_cast<std::chrono::steady_clock::duration>(tickLength);
+            std::this_thread::sleep_until(nextTick);
+        }
+    }
+    for (auto& sim : sims) sim.client->Update();
+
+    // -----------------------------
+    // Report
+    // -----------------------------
+    const double seconds = ticks / config.tickRate; // simulated time
+    std::vector<double> downKBs, upKBs;
+    uint64_t snapBytes = 0, sectionBytes = 0, entityBytes = 0;
+    size_t chunksHeld = 0;
+    for (auto& sim : sims) {
+        const Transport& tr = sim.client->GetTransport();
+        downKBs.push_back(tr.BytesReceived() / seconds / 1024.0);
+        upKBs.push_back(tr.BytesSent() / seconds / 1024.0);
+        snapBytes += sim.client->BytesReceivedFor(MessageType::ChunkSnapshot);
+        sectionBytes += sim.client->BytesReceivedFor(MessageType::SectionDelta);
+        entityBytes += sim.client->BytesReceivedFor(MessageType::EntityDelta);
+        chunksHeld += sim.client->ChunkCount();
+    }
+    double downAvg = 0.0, upAvg = 0.0;
+    for (double v : downKBs) downAvg += v;
+    for (double v : upKBs) upAvg += v;
+    downAvg /= std::max<size_t>(1, downKBs.size());
+    upAvg /= std::max<size_t>(1, upKBs.size());
+
+    const char* mode = connectPort ? "tcp (external server)" : tcpPort ? "tcp loopback" : "in-process";
+    std::printf("clients %d | ticks %d (%.1f s simulated) | transport %s\n", numClients, ticks, seconds, mode);
+    std::printf("per-client down: avg %.2f KB/s, max %.2f KB/s | up: avg %.2f KB/s\n",
+        downAvg, percentile(downKBs, 1.0), upAvg);
+    std::printf("down by type (all clients): snapshots %.1f KB, section deltas %.1f KB, entity deltas %.1f KB\n",
+        snapBytes / 1024.0, sectionBytes / 1024.0, entityBytes / 1024.0);
+    std::printf("avg chunks held per client: %.1f\n", static_cast<double>(chunksHeld) / std::max(1, numClients));
+    if (server) {
+        double sum = 0.0;
+        for (double v : tickMs) sum += v;
+        std::printf("server tick: avg %.3f ms, p50 %.3f ms, p95 %.3f ms, max %.3f ms | chunks loaded %zu, evicted %llu\n",
+            sum / std::max<size_t>(1, tickMs.size()), percentile(tickMs, 0.5), percentile(tickMs, 0.95),
+            percentile(tickMs, 1.0), server->LoadedChunks(), static_cast<unsigned long long>(server->EvictedChunks()));
+    }
+    return 0;
+}
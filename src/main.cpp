@@ -1,6 +1,9 @@
 // main.cpp
-// Entry point: creates window, compiles shader, creates a Chunk and renders it.
-// Movement: WASD + mouse look. Hold Left Shift to sprint.
+// Entry point: creates window, compiles shaders, streams chunks around the
+// camera through a ChunkCache and renders them.
+// Movement: WASD + mouse look. Hold Left Shift to sprint. M prints memory usage.
+// P prints the block under the crosshair.
+// F toggles between per-vertex (default) and per-face (vertex-pulled) chunk meshes.
 // No collisions here (you can go below/through terrain).
 
 #include <glad/glad.h>
@@ -10,10 +13,16 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 #include "Camera.hpp"
-#include "Chunk.hpp"
+#include "ChunkMesh.hpp"
+#include "ChunkCache.hpp"
+#include "ChunkShaders.hpp"
+#include "GridCoords.hpp"
+#include "UploadPipeline.hpp"
 
 // -----------------------------
 // Globals (camera, timing, window)
@@ -28,6 +37,14 @@ static bool firstMouse = true;
 const int WIN_WIDTH = 1280;
 const int WIN_HEIGHT = 720;
 
+// Chunk streaming: chunks within VIEW_RADIUS (in chunks) of the camera are kept
+// resident; everything else is evicted LRU once the memory budget is exceeded.
+const int CHUNK_SIZE = 32;
+const int VIEW_RADIUS = 3;
+const size_t CHUNK_MEMORY_BUDGET = 256u << 20; // bytes
+const uint32_t WORLD_SEED = 123456;             // change for a different world
+const float PICK_DISTANCE = 1000.0f;            // blocks
+
 // -----------------------------
 // Mouse callback - forwards offsets to camera
 // -----------------------------
@@ -83,48 +100,6 @@ static void processInput(GLFWwindow* window) {
     camera.Position = nextPos;
 }
 
-// -----------------------------
-// Minimal shader sources (position + color)
-// -----------------------------
-static const char* vertexShaderSource = R"glsl(
-#version 330 core
-layout(location = 0) in vec3 aPos;
-layout(location = 1) in vec3 aColor;
-out vec3 vColor;
-uniform mat4 u_MVP;
-void main() {
-    vColor = aColor;
-    gl_Position = u_MVP * vec4(aPos, 1.0);
-}
-)glsl";
-
-static const char* fragmentShaderSource = R"glsl(
-#version 330 core
-in vec3 vColor;
-out vec4 FragColor;
-void main() {
-    FragColor = vec4(vColor, 1.0);
-}
-)glsl";
-
-// -----------------------------
-// Helper: compile shader
-// -----------------------------
-static unsigned int CompileShader(GLenum type, const char* src) {
-    unsigned int sh = glCreateShader(type);
-    glShaderSource(sh, 1, &src, nullptr);
-    glCompileShader(sh);
-
-    int ok = 0;
-    glGetShaderiv(sh, GL_COMPILE_STATUS, &ok);
-    if (!ok) {
-        char log[1024];
-        glGetShaderInfoLog(sh, 1024, nullptr, log);
-        std::cerr << "Shader compile error: " << log << "\n";
-    }
-    return sh;
-}
-
 // -----------------------------
 // main()
 // -----------------------------
@@ -161,56 +136,95 @@ int main() {
     }
 
     // Compile & link shaders
-    unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-    unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-    unsigned int shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vs);
-    glAttachShader(shaderProgram, fs);
-    glLinkProgram(shaderProgram);
-
-    // Check link status
-    int ok = 0;
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &ok);
-    if (!ok) {
-        char log[1024];
-        glGetProgramInfoLog(shaderProgram, 1024, nullptr, log);
-        std::cerr << "Program link error: " << log << "\n";
-    }
-    glDeleteShader(vs);
-    glDeleteShader(fs);
+    unsigned int shaderProgram = CreateChunkShaderProgram();
+    unsigned int faceShaderProgram = CreateFaceShaderProgram();
+
+    // The face palette never changes: load it once. Without it only the vertex path works.
+    const bool faceRenderingAvailable = ChunkMesh::LoadFacePalette(faceShaderProgram);
+    if (!faceRenderingAvailable) ChunkMesh::SetFaceRendering(false);
 
     glEnable(GL_DEPTH_TEST);
 
     // Adjust default outline thickness here if you want a different starting value:
-    // Chunk::SetOutlineThickness(2.0f);
-    // Default is defined inside Chunk.cpp (1.5f by default).
-
-    // Create a single chunk at origin
-    const int CHUNK_SIZE = 32;
-    Chunk chunk(0, 0, CHUNK_SIZE, CHUNK_SIZE);
-    chunk.BuildMesh(); // generates mesh and outlines
-
-    // Main loop
-    while (!glfwWindowShouldClose(window)) {
-        float currentFrame = static_cast<float>(glfwGetTime());
-        deltaTime = currentFrame - lastFrame;
-        lastFrame = currentFrame;
-
-        glfwPollEvents();
-        processInput(window);
-
-        // Render
-        glClearColor(0.53f, 0.80f, 0.92f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        // Compute MVP
-        glm::mat4 view = camera.GetViewMatrix();
-        glm::mat4 projection = glm::perspective(glm::radians(70.0f), (float)WIN_WIDTH / (float)WIN_HEIGHT, 0.1f, 500.0f);
-
-        // Draw chunk
-        chunk.Draw(shaderProgram, view, projection);
-
-        glfwSwapBuffers(window);
+    // ChunkMesh::SetOutlineThickness(2.0f);
+    // Default is defined inside ChunkMesh.cpp (1.5f by default).
+
+    // GL-owning objects live in this block so their destructors run while the
+    // context is still current (before glfwTerminate).
+    {
+        // Mesh uploads go through a staging ring with a per-frame byte budget.
+        // Declared before the chunk cache so it outlives every chunk.
+        UploadPipeline uploader;
+
+        // Resident chunks (generated on demand, meshes queued on the uploader)
+        ChunkCache chunks(CHUNK_MEMORY_BUDGET, CHUNK_SIZE, &uploader, WORLD_SEED);
+        bool reportKeyDown = false;
+        bool faceKeyDown = false;
+        bool pickKeyDown = false;
+
+        // Main loop
+        while (!glfwWindowShouldClose(window)) {
+            float currentFrame = static_cast<float>(glfwGetTime());
+            deltaTime = currentFrame - lastFrame;
+            lastFrame = currentFrame;
+
+            glfwPollEvents();
+            processInput(window);
+
+            // M: print live memory report (edge-triggered)
+            bool reportKey = glfwGetKey(window, GLFW_KEY_M) == GLFW_PRESS;
+            if (reportKey && !reportKeyDown)
+                std::cout << chunks.Report().ToString() << "\n";
+            reportKeyDown = reportKey;
+
+            // P: pick the terrain block under the crosshair (edge-triggered)
+            bool pickKey = glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS;
+            if (pickKey && !pickKeyDown) {
+                RayHit hit;
+                if (chunks.GetTerrain().Raycast(camera.Position, glm::normalize(camera.Front), PICK_DISTANCE, hit))
+                    std::cout << "Block (" << hit.block.x << ", " << hit.block.y << ", " << hit.block.z << ") at "
+                        << hit.distance << " blocks\n";
+                else
+                    std::cout << "No block within " << PICK_DISTANCE << " blocks\n";
+            }
+            pickKeyDown = pickKey;
+
+            // F: switch mesh format and rebuild everything resident (edge-triggered)
+            bool faceKey = glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS;
+            if (faceKey && !faceKeyDown && faceRenderingAvailable) {
+                ChunkMesh::SetFaceRendering(!ChunkMesh::GetFaceRendering());
+                chunks.RebuildMeshes();
+                std::cout << "Face rendering " << (ChunkMesh::GetFaceRendering() ? "on" : "off") << "\n";
+            }
+            faceKeyDown = faceKey;
+
+            // Render
+            glClearColor(0.53f, 0.80f, 0.92f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+            // Compute MVP
+            glm::mat4 view = camera.GetViewMatrix();
+            glm::mat4 projection = glm::perspective(glm::radians(70.0f), (float)WIN_WIDTH / (float)WIN_HEIGHT, 0.1f, 500.0f);
+
+            // Touch every chunk in view range (creating missing ones), then draw
+            chunks.BeginFrame();
+            int camCX = FloorDiv(static_cast<int>(std::floor(camera.Position.x)), CHUNK_SIZE);
+            int camCZ = FloorDiv(static_cast<int>(std::floor(camera.Position.z)), CHUNK_SIZE);
+            for (int cz = camCZ - VIEW_RADIUS; cz <= camCZ + VIEW_RADIUS; ++cz)
+                for (int cx = camCX - VIEW_RADIUS; cx <= camCX + VIEW_RADIUS; ++cx)
+                    chunks.Get(cx, cz);
+
+            // Commit queued mesh uploads within this frame's budget
+            uploader.Update(camera.Position);
+
+            for (int cz = camCZ - VIEW_RADIUS; cz <= camCZ + VIEW_RADIUS; ++cz)
+                for (int cx = camCX - VIEW_RADIUS; cx <= camCX + VIEW_RADIUS; ++cx)
+                    chunks.GetMesh(cx, cz).Draw(shaderProgram, faceShaderProgram, view, projection);
+
+            chunks.EnforceBudget();
+
+            glfwSwapBuffers(window);
+        }
     }
 
     // Cleanup and exit
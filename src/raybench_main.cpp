@@ -0,0 +1,124 @@
+// raybench_main.cpp
+// Benchmark for TerrainQuadtree: hierarchical Raycast against the per-cell
+// RaycastPerCell baseline over long rays. Generates a square world of chunks
+// (same generators as ChunkCache), casts the same rays with both methods,
+// checks that they report the same hits and prints microseconds per ray.
+//
+// Usage: Minecraft_RayBench [--chunks N] [--rays R] [--distance D] [--seed S]
+// Exits non-zero if the two methods disagree on any ray or report a hit on a
+// block that is not solid.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BiomeMap.hpp"
+#include "Chunk.hpp"
+#include "DensityTerrain.hpp"
+#include "GridCoords.hpp"
+#include "HeightPyramid.hpp"
+
+int main(int argc, char** argv) {
+    int worldChunks = 40;    // per side: 40 * 32 = 1280 blocks
+    int numRays = 2000;
+    float maxDistance = 1000.0f;
+    uint32_t seed = 123456;
+    const int chunkSize = 32;
+
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&](int fallback) { return i + 1 < argc ? std::atoi(argv[++i]) : fallback; };
+        if (!std::strcmp(argv[i], "--chunks")) worldChunks = next(worldChunks);
+        else if (!std::strcmp(argv[i], "--rays")) numRays = next(numRays);
+        else if (!std::strcmp(argv[i], "--distance")) maxDistance = static_cast<float>(next(1000));
+        else if (!std::strcmp(argv[i], "--seed")) seed = static_cast<uint32_t>(next(123456));
+        else {
+            std::fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return -1;
+        }
+    }
+
+    // -----------------------------
+    // World
+    // -----------------------------
+    auto t0 = std::chrono::steady_clock::now();
+    BiomeMap biomeMap(seed);
+    DensityTerrain density(seed);
+    TerrainQuadtree terrain(chunkSize);
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    chunks.reserve(static_cast<size_t>(worldChunks) * static_cast<size_t>(worldChunks));
+    const int half = worldChunks / 2;
+    for (int cz = -half; cz < worldChunks - half; ++cz) {
+        for (int cx = -half; cx < worldChunks - half; ++cx) {
+            chunks.push_back(std::make_unique<Chunk>(cx * chunkSize, cz * chunkSize, chunkSize, chunkSize, &biomeMap, &density));
+            terrain.Insert(cx, cz, chunks.back().get());
+        }
+    }
+    double genMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    // -----------------------------
+    // Rays: from near the world centre, mostly shallow so they travel far
+    // -----------------------------
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> uni(0.0f, 1.0f);
+    struct Ray { glm::vec3 origin, dir; };
+    std::vector<Ray> rays(static_cast<size_t>(numRays));
+    const float span = static_cast<float>(chunkSize * 4);
+    for (Ray& r : rays) {
+        r.origin = glm::vec3((uni(rng) - 0.5f) * span, 40.0f + uni(rng) * 40.0f, (uni(rng) - 0.5f) * span);
+        float yaw = uni(rng) * 6.2831853f;
+        float pitch = -0.12f + uni(rng) * 0.14f;
+        r.dir = glm::normalize(glm::vec3(std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch)));
+    }
+
+    std::vector<RayHit> fast(rays.size()), slow(rays.size());
+    std::vector<char> fastHit(rays.size()), slowHit(rays.size());
+
+    t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < rays.size(); ++i)
+        fastHit[i] = terrain.Raycast(rays[i].origin, rays[i].dir, maxDistance, fast[i]);
+    double fastUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+
+    t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < rays.size(); ++i)
+        slowHit[i] = terrain.RaycastPerCell(rays[i].origin, rays[i].dir, maxDistance, slow[i]);
+    double slowUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+
+    // -----------------------------
+    // Compare + report
+    // -----------------------------
+    int hits = 0, mismatches = 0, airHits = 0;
+    double hitDistance = 0.0;
+    auto solidAt = [&](const glm::ivec3& b) {
+        const int cx = FloorDiv(b.x, chunkSize), cz = FloorDiv(b.z, chunkSize);
+        const size_t idx = static_cast<size_t>(cz + half) * worldChunks + static_cast<size_t>(cx + half);
+        return chunks[idx]->IsSolidAt(b.x, b.y, b.z);
+    };
+    for (size_t i = 0; i < rays.size(); ++i) {
+        bool same = fastHit[i] == slowHit[i];
+        if (same && fastHit[i])
+            same = fast[i].block == slow[i].block && std::fabs(fast[i].distance - slow[i].distance) < 1e-3f;
+        if (!same) {
+            if (mismatches < 5)
+                std::fprintf(stderr, "ray %zu: hierarchical %s (%d,%d,%d) vs per-cell %s (%d,%d,%d)\n", i,
+                    fastHit[i] ? "hit" : "miss", fast[i].block.x, fast[i].block.y, fast[i].block.z,
+                    slowHit[i] ? "hit" : "miss", slow[i].block.x, slow[i].block.y, slow[i].block.z);
+            ++mismatches;
+        }
+        if (fastHit[i]) {
+            ++hits;
+            hitDistance += fast[i].distance;
+            if (!solidAt(fast[i].block)) ++airHits;
+        }
+    }
+
+    std::printf("world %dx%d chunks (%.0f ms to generate) | %d rays, max %.0f blocks | %d hits, mean hit distance %.1f\n",
+        worldChunks, worldChunks, genMs, numRays, maxDistance, hits, hits ? hitDistance / hits : 0.0);
+    std::printf("hierarchical %.2f us/ray | per-cell %.2f us/ray | speedup %.1fx | mismatches %d | hits on air %d\n",
+        fastUs / numRays, slowUs / numRays, fastUs > 0.0 ? slowUs / fastUs : 0.0, mismatches, airHits);
+    return mismatches == 0 && airHits == 0 ? 0 : 1;
+}
@@ -0,0 +1,248 @@
+// rendercompare_main.cpp
+// Renders the same chunks offscreen with the per-vertex and the face-record
+// mesh paths and compares the images pixel for pixel. Also reports the draw
+// time, rebuild time and GPU mesh size of each path. Runs without a window
+// through EGL (surfaceless where available, e.g. Mesa llvmpipe), so it works
+// on headless machines. Draw times there are software rasterizer timings, not
+// a stand-in for a real GPU.
+//
+// Usage: Minecraft_RenderCompare [--radius R] [--seed S] [--face-limit N] [--out DIR]
+//   R is the chunk grid radius around the origin (default 3 = 7x7 chunks).
+//   N lowers ChunkMesh::SetFaceRecordLimit so larger chunks fall back to
+//   vertices, mixing both formats in the face render.
+//   DIR receives view<i>_vertex.ppm / view<i>_face.ppm for inspection.
+// Exits non-zero if any pixel differs, or if no GL 3.3 context is available.
+
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "ChunkCache.hpp"
+#include "ChunkMesh.hpp"
+#include "ChunkShaders.hpp"
+#include "UploadPipeline.hpp"
+
+static const int kWidth = 1280;
+static const int kHeight = 720;
+static const int kDrawRepeats = 3;
+
+struct View {
+    glm::vec3 eye, target;
+};
+
+// close up, overview, long diagonal, low inside the terrain
+static const View kViews[] = {
+    { {16.0f, 20.0f, 40.0f}, {16.0f, 10.0f, 0.0f} },
+    { {0.0f, 70.0f, 0.0f}, {60.0f, 0.0f, 60.0f} },
+    { {-40.0f, 30.0f, -40.0f}, {40.0f, 5.0f, 40.0f} },
+    { {5.0f, 12.0f, 5.0f}, {30.0f, 0.0f, 20.0f} },
+};
+
+// -----------------------------
+// Headless GL 3.3 core context with an RGBA8 + depth framebuffer
+// -----------------------------
+static bool createContext() {
+    EGLDisplay display = EGL_NO_DISPLAY;
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+    auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (getPlatformDisplay)
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+#endif
+    if (display == EGL_NO_DISPLAY) display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    EGLint major = 0, minor = 0;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        std::fprintf(stderr, "EGL initialization failed\n");
+        return false;
+    }
+    eglBindAPI(EGL_OPENGL_API);
+
+    const EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    eglChooseConfig(display, configAttribs, &config, 1, &configCount);
+
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE };
+    EGLContext context = eglCreateContext(display, configCount ? config : nullptr, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        std::fprintf(stderr, "Failed to create a surfaceless GL 3.3 core context\n");
+        return false;
+    }
+    if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress))) {
+        std::fprintf(stderr, "Failed to initialize GLAD\n");
+        return false;
+    }
+    return true;
+}
+
+static void createFramebuffer() {
+    unsigned int fbo = 0, renderbuffers[2] = {};
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(2, renderbuffers);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, kWidth, kHeight);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, kWidth, kHeight);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, renderbuffers[1]);
+
+    glViewport(0, 0, kWidth, kHeight);
+}
+
+// binary PPM, top row first (glReadPixels returns the bottom row first)
+static void savePpm(const std::string& path, const std::vector<unsigned char>& rgba) {
+    FILE* out = std::fopen(path.c_str(), "wb");
+    if (!out) {
+        std::fprintf(stderr, "cannot write %s\n", path.c_str());
+        return;
+    }
+    std::fprintf(out, "P6 %d %d 255\n", kWidth, kHeight);
+    for (int y = kHeight - 1; y >= 0; --y)
+        for (int x = 0; x < kWidth; ++x)
+            std::fwrite(&rgba[(static_cast<size_t>(y) * kWidth + x) * 4], 1, 3, out);
+    std::fclose(out);
+}
+
+int main(int argc, char** argv) {
+    int radius = 3;
+    uint32_t seed = 123456;
+    size_t faceLimit = 0;
+    std::string outDir;
+
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&](int fallback) { return i + 1 < argc ? std::atoi(argv[++i]) : fallback; };
+        if (!std::strcmp(argv[i], "--radius")) radius = next(radius);
+        else if (!std::strcmp(argv[i], "--seed")) seed = static_cast<uint32_t>(next(123456));
+        else if (!std::strcmp(argv[i], "--face-limit")) faceLimit = static_cast<size_t>(next(0));
+        else if (!std::strcmp(argv[i], "--out") && i + 1 < argc) outDir = argv[++i];
+        else {
+            std::fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return -1;
+        }
+    }
+
+    if (!createContext()) return 1;
+    std::printf("%s | %s\n", glGetString(GL_RENDERER), glGetString(GL_VERSION));
+    createFramebuffer();
+    glEnable(GL_DEPTH_TEST);
+
+    const unsigned int shaderProgram = CreateChunkShaderProgram();
+    const unsigned int faceShaderProgram = CreateFaceShaderProgram();
+    if (!ChunkMesh::LoadFacePalette(faceShaderProgram)) return 1;
+    ChunkMesh::SetOutlineThickness(1.0f);
+    ChunkMesh::SetFaceRecordLimit(faceLimit);
+
+    bool ok = true;
+    {
+        // same ownership order as the game: the uploader outlives every mesh
+        UploadPipeline uploader;
+        ChunkCache chunks(256u << 20, 32, &uploader, seed);
+
+        using Clock = std::chrono::steady_clock;
+        auto msSince = [](Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        };
+
+        auto drawAll = [&](const glm::mat4& view, const glm::mat4& projection) {
+            glClearColor(0.53f, 0.80f, 0.92f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            for (int cz = -radius; cz <= radius; ++cz)
+                for (int cx = -radius; cx <= radius; ++cx)
+                    chunks.GetMesh(cx, cz).Draw(shaderProgram, faceShaderProgram, view, projection);
+        };
+
+        struct Result {
+            std::vector<unsigned char> pixels;
+            double rebuildMs = 0.0, drawMs = 0.0;
+            size_t gpuBytes = 0;
+        };
+
+        // Rebuilds every chunk in the requested format, drains the uploader,
+        // then times the best of kDrawRepeats draws after one warm-up draw.
+        auto render = [&](const View& v, bool faces) {
+            Result r;
+            ChunkMesh::SetFaceRendering(faces);
+            chunks.BeginFrame();
+            for (int cz = -radius; cz <= radius; ++cz)
+                for (int cx = -radius; cx <= radius; ++cx)
+                    chunks.Get(cx, cz);
+            Clock::time_point start = Clock::now();
+            chunks.RebuildMeshes();
+            r.rebuildMs = msSince(start);
+            while (uploader.PendingCount() > 0) uploader.Update(v.eye);
+            r.gpuBytes = chunks.Report().gpuMeshBytes;
+
+            const glm::mat4 view = glm::lookAt(v.eye, v.target, glm::vec3(0.0f, 1.0f, 0.0f));
+            const glm::mat4 projection = glm::perspective(glm::radians(70.0f),
+                static_cast<float>(kWidth) / kHeight, 0.1f, 500.0f);
+            drawAll(view, projection);
+            for (int rep = 0; rep < kDrawRepeats; ++rep) {
+                glFinish();
+                start = Clock::now();
+                drawAll(view, projection);
+                glFinish();
+                double ms = msSince(start);
+                if (rep == 0 || ms < r.drawMs) r.drawMs = ms;
+            }
+
+            r.pixels.resize(static_cast<size_t>(kWidth) * kHeight * 4);
+            glReadPixels(0, 0, kWidth, kHeight, GL_RGBA, GL_UNSIGNED_BYTE, r.pixels.data());
+            return r;
+        };
+
+        const int side = 2 * radius + 1;
+        std::printf("%dx%d chunks, %dx%d pixels, vertex | face\n", side, side, kWidth, kHeight);
+        for (size_t vi = 0; vi < sizeof(kViews) / sizeof(kViews[0]); ++vi) {
+            const Result vertex = render(kViews[vi], false);
+            const Result face = render(kViews[vi], true);
+
+            size_t differing = 0;
+            int maxDelta = 0;
+            for (size_t i = 0; i < vertex.pixels.size(); ++i) {
+                int delta = std::abs(static_cast<int>(vertex.pixels[i]) - static_cast<int>(face.pixels[i]));
+                if (delta) ++differing;
+                maxDelta = std::max(maxDelta, delta);
+            }
+
+            std::printf("view %zu: draw %7.1f | %7.1f ms, rebuild %6.1f | %6.1f ms, gpu mesh %6.2f | %6.2f MB, "
+                "differing channels %zu (max delta %d)\n",
+                vi, vertex.drawMs, face.drawMs, vertex.rebuildMs, face.rebuildMs,
+                vertex.gpuBytes / 1048576.0, face.gpuBytes / 1048576.0, differing, maxDelta);
+
+            if (!outDir.empty()) {
+                savePpm(outDir + "/view" + std::to_string(vi) + "_vertex.ppm", vertex.pixels);
+                savePpm(outDir + "/view" + std::to_string(vi) + "_face.ppm", face.pixels);
+            }
+            if (differing) {
+                std::fprintf(stderr, "FAIL: view %zu differs between the vertex and face renders\n", vi);
+                ok = false;
+            }
+        }
+    }
+
+    GLenum error = glGetError();
+    if (error != GL_NO_ERROR) {
+        std::fprintf(stderr, "FAIL: GL error 0x%x\n", error);
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+// server_main.cpp
+// Headless world server: accepts local TCP clients and runs WorldServer at a
+// fixed tick rate. Prints tick time and outgoing bandwidth every few seconds.
+//
+// Usage: Minecraft_Server [port] [seed]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+#include "Transport.hpp"
+#include "WorldServer.hpp"
+
+int main(int argc, char** argv) {
+    uint16_t port = argc > 1 ? static_cast<uint16_t>(std::atoi(argv[1])) : 25570;
+    WorldServer::Config config;
+    if (argc > 2) config.seed = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+
+    auto listener = TcpListener::Listen(port);
+    if (!listener) {
+        std::cerr << "Failed to listen on 127.0.0.1:" << port << "\n";
+        return -1;
+    }
+    std::cout << "Listening on 127.0.0.1:" << port << " (seed " << config.seed << ")\n";
+
+    WorldServer server(config);
+    const auto tickLength = std::chrono::duration<double>(1.0 / config.tickRate);
+    auto nextTick = std::chrono::steady_clock::now();
+
+    double tickMsSum = 0.0, tickMsMax = 0.0;
+    uint64_t lastBytesSent = 0;
+    const uint32_t reportEvery = static_cast<uint32_t>(config.tickRate * 5.0f);
+
+    for (;;) {
+        while (auto transport = listener->Accept()) {
+            uint32_t id = server.AddClient(std::move(transport));
+            std::cout << "Client " << id << " connected (" << server.ClientCount() << " total)\n";
+        }
+
+        server.Tick();
+        tickMsSum += server.LastTickMs();
+        tickMsMax = std::max(tickMsMax, server.LastTickMs());
+
+        if (server.CurrentTick() % reportEvery == 0) {
+            std::cout << "tick " << server.CurrentTick()
+                << " | clients " << server.ClientCount()
+                << " | chunks " << server.LoadedChunks() << " (evicted " << server.EvictedChunks() << ")"
+                << " | tick avg " << tickMsSum / reportEvery << " ms, max " << tickMsMax << " ms"
+                << " | out " << (server.BytesSent() - lastBytesSent) / 5.0 / 1024.0 << " KB/s\n";
+            lastBytesSent = server.BytesSent();
+            tickMsSum = 0.0;
+            tickMsMax = 0.0;
+        }
+
+        nextTick += std::chrono::duration_cast<std::chrono::steady_clock::duration>(tickLength);
+        std::this_thread::sleep_until(nextTick);
+    }
+}
@@ -0,0 +1,15 @@
+// Check.hpp
+// Assertion macro shared by the unit tests: prints the failing condition with
+// its location and exits non-zero, so ctest reports the test as failed.
+
+#pragma once
+#include <cstdio>
+#include <cstdlib>
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            std::exit(1);                                                  \
+        }                                                                  \
+    } while (0)
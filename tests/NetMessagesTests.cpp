@@ -0,0 +1,84 @@
+// NetMessagesTests.cpp
+// Chunk snapshot round trip and rejection of hostile snapshot headers. Run
+// through ctest; exits non-zero on the first failing check.
+
+#include "Check.hpp"
+#include "NetMessages.hpp"
+
+#include <cstdio>
+#include <vector>
+
+// Snapshot header (type byte stripped) with no RLE payload after it.
+static std::vector<uint8_t> header(uint64_t sx, uint64_t sz, uint64_t sy) {
+    ByteWriter w;
+    w.VarS(-3);
+    w.VarS(7);
+    w.VarU(sx);
+    w.VarU(sz);
+    w.VarU(sy);
+    return std::move(w.Data());
+}
+
+static void snapshotRoundTrip() {
+    ChunkSnapshotMsg msg;
+    msg.cx = -3;
+    msg.cz = 7;
+    msg.sizeX = msg.sizeZ = 32;
+    msg.sizeY = 64;
+    msg.voxels.assign(32 * 32 * 64, 0);
+    for (size_t i = 0; i < 32 * 32 * 20; ++i) msg.voxels[i] = 1;
+    msg.biomes.assign(32 * 32, 2);
+
+    std::vector<uint8_t> buf = EncodeChunkSnapshot(msg);
+    CHECK(buf[0] == static_cast<uint8_t>(MessageType::ChunkSnapshot));
+    ByteReader in(buf.data() + 1, buf.size() - 1);
+    ChunkSnapshotMsg out;
+    CHECK(DecodeChunkSnapshot(in, out));
+    CHECK(in.AtEnd());
+    CHECK(out.cx == -3 && out.cz == 7 && out.sizeX == 32 && out.sizeZ == 32 && out.sizeY == 64);
+    CHECK(out.voxels == msg.voxels && out.biomes == msg.biomes);
+}
+
+static void snapshotRejectsOversizedHeaders() {
+    const uint64_t bad[][3] = {
+        { 0, 32, 64 }, { 32, 0, 64 }, { 32, 32, 0 },
+        { kMaxSnapshotSizeXZ + 1, 32, 64 }, { 32, kMaxSnapshotSizeXZ + 1, 64 },
+        { 32, 32, kMaxSnapshotSizeY + 1 }, { 1024, 1024, 1024 }, { ~0ull, ~0ull, ~0ull },
+    };
+    for (const auto& s : bad) {
+        std::vector<uint8_t> buf = header(s[0], s[1], s[2]);
+        ByteReader in(buf);
+        ChunkSnapshotMsg out;
+        CHECK(!DecodeChunkSnapshot(in, out));
+        CHECK(out.voxels.capacity() == 0); // rejected before allocating
+    }
+}
+
+static void snapshotHeaderDoesNotReserve() {
+    // Largest legal header but no payload: decoding fails on truncation
+    // without having allocated the 1 MiB the header describes.
+    std::vector<uint8_t> buf = header(kMaxSnapshotSizeXZ, kMaxSnapshotSizeXZ, kMaxSnapshotSizeY);
+    ByteReader in(buf);
+    ChunkSnapshotMsg out;
+    CHECK(!DecodeChunkSnapshot(in, out));
+    CHECK(out.voxels.capacity() == 0);
+}
+
+static void rleRejectsOverlongRuns() {
+    ByteWriter w;
+    w.VarU(10);
+    w.U8(1);
+    std::vector<uint8_t> out;
+    ByteReader in(w.Data());
+    CHECK(!RleDecode(in, 4, out)); // run longer than the array
+    CHECK(out.empty());
+}
+
+int main() {
+    snapshotRoundTrip();
+    snapshotRejectsOversizedHeaders();
+    snapshotHeaderDoesNotReserve();
+    rleRejectsOverlongRuns();
+    std::printf("NetMessagesTests: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,117 @@
+// TerrainQuadtreeTests.cpp
+// TerrainQuadtree region queries against a direct scan over the loaded
+// chunks' column heights: random rects (partly outside the loaded area
+// included), then again after Remove, re-Insert and a block edit. Exits
+// non-zero on the first failing check.
+
+#include "BiomeMap.hpp"
+#include "Check.hpp"
+#include "Chunk.hpp"
+#include "GridCoords.hpp"
+#include "HeightPyramid.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+static const int kChunkSize = 32;
+static const int kGridMin = -2, kGridMax = 2; // 5x5 chunks around the origin
+
+using ChunkMap = std::unordered_map<int64_t, Chunk*>; // what the tree should see
+
+// Min/max over every loaded column in the inclusive rect; unloaded columns are empty.
+static HeightRange bruteQuery(const ChunkMap& loaded, int x0, int z0, int x1, int z1) {
+    HeightRange r;
+    for (int z = z0; z <= z1; ++z) {
+        for (int x = x0; x <= x1; ++x) {
+            int cx = FloorDiv(x, kChunkSize), cz = FloorDiv(z, kChunkSize);
+            auto it = loaded.find(GridKey(cx, cz));
+            if (it == loaded.end()) continue;
+            int h = it->second->GetHeights()[static_cast<size_t>(x - cx * kChunkSize)
+                + static_cast<size_t>(z - cz * kChunkSize) * kChunkSize];
+            r.Merge(HeightRange{ h, h });
+        }
+    }
+    return r;
+}
+
+static void checkRandomRects(const TerrainQuadtree& tree, const ChunkMap& loaded, std::mt19937& rng, int count) {
+    // rects reach one chunk past the loaded grid on every side
+    std::uniform_int_distribution<int> coord((kGridMin - 1) * kChunkSize, (kGridMax + 2) * kChunkSize - 1);
+    std::uniform_int_distribution<int> extent(0, 3 * kChunkSize);
+    for (int i = 0; i < count; ++i) {
+        int x0 = coord(rng), z0 = coord(rng);
+        int x1 = x0 + extent(rng), z1 = z0 + (i % 8 == 0 ? 0 : extent(rng)); // some single rows
+        HeightRange expected = bruteQuery(loaded, x0, z0, x1, z1);
+        HeightRange got = tree.Query(x0, z0, x1, z1);
+        CHECK(got.IsEmpty() == expected.IsEmpty());
+        if (!expected.IsEmpty()) {
+            CHECK(got.min == expected.min);
+            CHECK(got.max == expected.max);
+        }
+        int expectedTop = expected.IsEmpty() || expected.max <= 0 ? -1 : expected.max - 1;
+        CHECK(tree.HighestBlockY(x0, z0, x1, z1) == expectedTop);
+    }
+}
+
+static void queriesMatchColumnScan() {
+    BiomeMap biomeMap(4242);
+    std::vector<std::unique_ptr<Chunk>> owned;
+    ChunkMap loaded;
+    TerrainQuadtree tree(kChunkSize, 2); // few world levels: rects span several top nodes
+    for (int cz = kGridMin; cz <= kGridMax; ++cz) {
+        for (int cx = kGridMin; cx <= kGridMax; ++cx) {
+            owned.push_back(std::make_unique<Chunk>(cx * kChunkSize, cz * kChunkSize, kChunkSize, kChunkSize, &biomeMap));
+            loaded[GridKey(cx, cz)] = owned.back().get();
+            tree.Insert(cx, cz, owned.back().get());
+        }
+    }
+
+    std::mt19937 rng(7);
+    checkRandomRects(tree, loaded, rng, 400);
+
+    // whole loaded area at once
+    HeightRange all = bruteQuery(loaded, kGridMin * kChunkSize, kGridMin * kChunkSize,
+        (kGridMax + 1) * kChunkSize - 1, (kGridMax + 1) * kChunkSize - 1);
+    HeightRange got = tree.Query(kGridMin * kChunkSize, kGridMin * kChunkSize,
+        (kGridMax + 1) * kChunkSize - 1, (kGridMax + 1) * kChunkSize - 1);
+    CHECK(got.min == all.min && got.max == all.max);
+
+    // unload a few chunks, including the one holding the tallest column
+    Chunk* tallest = nullptr;
+    int cxTall = 0, czTall = 0;
+    for (const auto& entry : loaded) {
+        if (!tallest || entry.second->GetHeightPyramid().Root().max > tallest->GetHeightPyramid().Root().max) {
+            tallest = entry.second;
+            cxTall = GridKeyX(entry.first);
+            czTall = GridKeyZ(entry.first);
+        }
+    }
+    const int removed[][2] = { { cxTall, czTall }, { 0, 0 }, { kGridMin, kGridMax } };
+    for (const auto& c : removed) {
+        tree.Remove(c[0], c[1]);
+        loaded.erase(GridKey(c[0], c[1]));
+    }
+    CHECK(tree.Query(cxTall * kChunkSize, czTall * kChunkSize,
+        cxTall * kChunkSize + kChunkSize - 1, czTall * kChunkSize + kChunkSize - 1).IsEmpty());
+    checkRandomRects(tree, loaded, rng, 400);
+
+    // re-insert the tallest chunk after raising one of its columns
+    int lx = 0, lz = 0;
+    while (tallest->GetHeights()[static_cast<size_t>(lx)] >= tallest->GetMaxHeight()) ++lx; // room above
+    int h = tallest->GetHeights()[static_cast<size_t>(lx) + static_cast<size_t>(lz) * kChunkSize];
+    CHECK(tallest->SetBlockLocal(lx, h, lz, true));
+    tree.Insert(cxTall, czTall, tallest);
+    loaded[GridKey(cxTall, czTall)] = tallest;
+    CHECK(tree.HighestBlockY(cxTall * kChunkSize + lx, czTall * kChunkSize + lz,
+        cxTall * kChunkSize + lx, czTall * kChunkSize + lz) == h);
+    checkRandomRects(tree, loaded, rng, 400);
+}
+
+int main() {
+    queriesMatchColumnScan();
+    std::printf("TerrainQuadtreeTests: all checks passed\n");
+    return 0;
+}
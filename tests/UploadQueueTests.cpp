@@ -0,0 +1,178 @@
+// UploadQueueTests.cpp
+// GL-free checks for StagingRing wraparound/fencing and UploadScheduler
+// ordering. Run through ctest; exits non-zero on the first failing check.
+
+#include "Check.hpp"
+#include "UploadQueue.hpp"
+
+#include <cstdio>
+#include <vector>
+
+// -----------------------------
+// StagingRing
+// -----------------------------
+static void ringAlignsAndAdvances() {
+    StagingRing ring(1024);
+    size_t off = 99;
+    CHECK(ring.Allocate(10, 16, off));
+    CHECK(off == 0);
+    CHECK(ring.Allocate(10, 16, off));
+    CHECK(off == 16);           // aligned past the first 10 bytes
+    CHECK(ring.Used() == 26);   // padding counts as used
+    CHECK(!ring.Allocate(0, 16, off));
+    CHECK(!ring.Allocate(2048, 16, off)); // larger than the ring
+}
+
+static void ringWrapsAtTail() {
+    StagingRing ring(1024);
+    size_t off = 0;
+    CHECK(ring.Allocate(600, 16, off));
+    ring.Fence(1);
+    ring.Retire(1);             // drained: head resets to 0
+    CHECK(ring.Used() == 0 && ring.Head() == 0);
+
+    CHECK(ring.Allocate(600, 16, off));
+    ring.Fence(2);
+    CHECK(ring.Allocate(300, 16, off));
+    CHECK(off == 608);          // still fits before the end (8 bytes padding)
+    ring.Fence(3);
+    ring.Retire(2);             // frees [0, 600)
+
+    // 200 bytes do not fit in the 116-byte tail: skip it and wrap to 0
+    CHECK(ring.Allocate(200, 16, off));
+    CHECK(off == 0);
+    CHECK(ring.Head() == 200);
+    CHECK(ring.Used() == 308 + (1024 - 908) + 200); // fence 3 + skipped tail + new
+}
+
+static void ringRejectsOverrunOfUnretiredFences() {
+    StagingRing ring(1024);
+    size_t off = 0;
+    CHECK(ring.Allocate(600, 16, off));
+    ring.Fence(1);
+
+    // would wrap into [0, 600) which fence 1 still guards
+    CHECK(!ring.Allocate(600, 16, off));
+    CHECK(ring.Used() == 600);  // failed allocation changes nothing
+    CHECK(ring.Head() == 600);
+
+    // fits in the remaining tail
+    CHECK(ring.Allocate(400, 16, off));
+    CHECK(off == 608);
+    ring.Fence(2);
+    CHECK(!ring.Allocate(32, 16, off)); // tail too short, head of ring still fenced
+    CHECK(ring.InFlightFences() == 2);
+}
+
+static void ringResetsAfterRetire() {
+    StagingRing ring(1024);
+    size_t off = 0;
+    CHECK(ring.Allocate(500, 16, off));
+    ring.Fence(1);
+    CHECK(ring.Allocate(500, 16, off));
+    ring.Fence(2);
+
+    ring.Retire(1);
+    CHECK(ring.Used() == 512);  // fence 2 (with its padding) still in flight
+    CHECK(ring.InFlightFences() == 1);
+
+    ring.Retire(2);
+    CHECK(ring.Used() == 0);
+    CHECK(ring.Head() == 0);
+    CHECK(ring.InFlightFences() == 0);
+    CHECK(ring.Allocate(1024, 16, off)); // whole ring available again
+    CHECK(off == 0);
+}
+
+static void ringFenceWithoutAllocationIsNoop() {
+    StagingRing ring(256);
+    ring.Fence(1);
+    CHECK(ring.InFlightFences() == 0);
+}
+
+// -----------------------------
+// UploadScheduler
+// -----------------------------
+static void schedulerStopsAtBudget() {
+    UploadScheduler s(0.0f); // no aging: pure distance order
+    s.Enqueue(1, 100, 10.0f, 0);
+    s.Enqueue(2, 100, 20.0f, 0);
+    s.Enqueue(3, 100, 30.0f, 0);
+
+    std::vector<uint64_t> sel = s.Select(250, 0);
+    CHECK(sel.size() == 2);
+    CHECK(sel[0] == 1 && sel[1] == 2);
+    CHECK(s.PendingCount() == 3); // Select never removes
+    CHECK(s.PendingBytes() == 300);
+
+    sel = s.Select(300, 0);
+    CHECK(sel.size() == 3);
+}
+
+static void schedulerAlwaysTakesFirst() {
+    UploadScheduler s(0.0f);
+    s.Enqueue(1, 5000, 1.0f, 0);
+    s.Enqueue(2, 10, 2.0f, 0);
+
+    std::vector<uint64_t> sel = s.Select(100, 0);
+    CHECK(sel.size() == 1);       // oversized head still makes progress...
+    CHECK(sel[0] == 1);           // ...and blocks the rest of this frame
+}
+
+static void schedulerAgesWaitingUploads() {
+    UploadScheduler s(4.0f);
+    s.Enqueue(1, 10, 100.0f, 0);  // far, queued early
+    s.Enqueue(2, 10, 70.0f, 10);  // nearer, queued later
+
+    // frame 10: scores 100 - 40 = 60 vs 70 -> the old far one wins
+    std::vector<uint64_t> sel = s.Select(10, 10);
+    CHECK(sel.size() == 1 && sel[0] == 1);
+
+    // re-enqueue keeps the original age
+    s.Enqueue(1, 10, 100.0f, 10);
+    sel = s.Select(10, 10);
+    CHECK(sel[0] == 1);
+
+    // without aging the nearer one wins
+    UploadScheduler flat(0.0f);
+    flat.Enqueue(1, 10, 100.0f, 0);
+    flat.Enqueue(2, 10, 70.0f, 10);
+    CHECK(flat.Select(10, 10)[0] == 2);
+}
+
+static void schedulerBreaksTiesByAge() {
+    UploadScheduler s(0.0f);
+    s.Enqueue(2, 10, 5.0f, 3);
+    s.Enqueue(1, 10, 5.0f, 1);
+    std::vector<uint64_t> sel = s.Select(100, 3);
+    CHECK(sel.size() == 2 && sel[0] == 1 && sel[1] == 2);
+}
+
+static void schedulerRemoveAndUpdate() {
+    UploadScheduler s(0.0f);
+    s.Enqueue(1, 10, 5.0f, 0);
+    s.Enqueue(2, 10, 50.0f, 0);
+    s.UpdateDistance(2, 1.0f);
+    CHECK(s.Select(10, 0)[0] == 2);
+
+    CHECK(s.Remove(2));
+    CHECK(!s.Remove(2));
+    CHECK(!s.Contains(2) && s.Contains(1));
+    s.UpdateDistance(42, 0.0f); // unknown id: no-op
+    CHECK(s.PendingCount() == 1);
+}
+
+int main() {
+    ringAlignsAndAdvances();
+    ringWrapsAtTail();
+    ringRejectsOverrunOfUnretiredFences();
+    ringResetsAfterRetire();
+    ringFenceWithoutAllocationIsNoop();
+    schedulerStopsAtBudget();
+    schedulerAlwaysTakesFirst();
+    schedulerAgesWaitingUploads();
+    schedulerBreaksTiesByAge();
+    schedulerRemoveAndUpdate();
+    std::printf("UploadQueueTests: all checks passed\n");
+    return 0;
+}
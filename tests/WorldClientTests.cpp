@@ -0,0 +1,63 @@
+// WorldClientTests.cpp
+// Snapshot placement on the client: world coordinates map to the right
+// columns of non-square chunks, and a snapshot whose footprint disagrees with
+// the established grid is rejected. Exits non-zero on the first failing check.
+
+#include "Check.hpp"
+#include "NetMessages.hpp"
+#include "Transport.hpp"
+#include "WorldClient.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+static ChunkSnapshotMsg emptySnapshot(int cx, int cz, int sizeX, int sizeZ, int sizeY) {
+    ChunkSnapshotMsg snap;
+    snap.cx = cx;
+    snap.cz = cz;
+    snap.sizeX = sizeX;
+    snap.sizeZ = sizeZ;
+    snap.sizeY = sizeY;
+    snap.voxels.assign(static_cast<size_t>(sizeX) * sizeZ * sizeY, 0);
+    snap.biomes.assign(static_cast<size_t>(sizeX) * sizeZ, 0);
+    return snap;
+}
+
+static void nonSquareChunksMapByAxis() {
+    auto pair = LoopbackTransport::CreatePair();
+    LoopbackTransport& server = *pair.first;
+    WorldClient client(std::move(pair.second));
+
+    // 16 wide in x, 8 deep in z: chunk (1, -1) covers x 16..31, z -8..-1
+    ChunkSnapshotMsg snap = emptySnapshot(1, -1, 16, 8, 4);
+    const int lx = 3, ly = 2, lz = 5;
+    snap.voxels[static_cast<size_t>(lx) + 16 * (static_cast<size_t>(lz) + 8 * ly)] = 1;
+    server.Send(EncodeChunkSnapshot(snap));
+    CHECK(client.Update());
+    CHECK(client.ChunkCount() == 1);
+
+    CHECK(client.IsSolidAt(16 + lx, ly, -8 + lz));
+    CHECK(!client.IsSolidAt(16 + lx, ly, -8 + lz - 1));
+    CHECK(!client.IsSolidAt(16 + lx, ly, -8 + lz + 1));
+    CHECK(!client.IsSolidAt(16 + lx, ly, -16 + lz)); // where a 16x16 grid would put it
+}
+
+static void mismatchedFootprintIsRejected() {
+    auto pair = LoopbackTransport::CreatePair();
+    LoopbackTransport& server = *pair.first;
+    WorldClient client(std::move(pair.second));
+
+    server.Send(EncodeChunkSnapshot(emptySnapshot(0, 0, 16, 8, 4)));
+    CHECK(client.Update());
+    server.Send(EncodeChunkSnapshot(emptySnapshot(1, 0, 8, 16, 4)));
+    CHECK(!client.Update());
+    CHECK(client.ChunkCount() == 1);
+}
+
+int main() {
+    nonSquareChunksMapByAxis();
+    mismatchedFootprintIsRejected();
+    std::printf("WorldClientTests: all checks passed\n");
+    return 0;
+}